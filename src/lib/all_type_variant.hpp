@@ -63,6 +63,21 @@ using TypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(ty
 // Creates boost::variant from mpl vector
 using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVector>::type;
 
+struct to_vector_type {
+  template <typename T>
+  constexpr auto operator()(T type) {
+    return hana::type_c<pmr_vector<typename T::type>>;
+  }
+};
+
+// Extends to hana::make_tuple(hana::type_c<pmr_vector<int32_t>>, hana::type_c<pmr_vector<int64_t>>, ...);
+static constexpr auto vector_types = hana::transform(types, to_vector_type{});  // NOLINT
+
+using VectorTypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(vector_types));
+
+// Creates boost::variant<pmr_vector<int32_t>, pmr_vector<int64_t>, ...> from mpl vector
+using ColumnValues = typename boost::make_variant_over<detail::VectorTypesAsMplVector>::type;
+
 }  // namespace detail
 
 static constexpr auto types = detail::types;
@@ -70,6 +85,9 @@ static constexpr auto data_types = detail::data_types;
 
 using AllTypeVariant = detail::AllTypeVariant;
 
+// Holds the values of a single column as a typed vector, e.g., for bulk appends to tables
+using ColumnValues = detail::ColumnValues;
+
 /**
  * @defgroup Macros for explicitly instantiating template classes
  *
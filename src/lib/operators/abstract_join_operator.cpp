@@ -0,0 +1,55 @@
+#include "abstract_join_operator.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractJoinOperator::AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                                           const std::shared_ptr<const AbstractOperator> right,
+                                           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractOperator{left, right}, _column_ids{column_ids}, _scan_type{scan_type} {}
+
+const std::pair<ColumnID, ColumnID>& AbstractJoinOperator::column_ids() const { return _column_ids; }
+
+ScanType AbstractJoinOperator::scan_type() const { return _scan_type; }
+
+const std::string& AbstractJoinOperator::_join_column_type() const {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  Assert(_column_ids.first < left_table->column_count(), "Join column of the left input does not exist");
+  Assert(_column_ids.second < right_table->column_count(), "Join column of the right input does not exist");
+
+  const auto& data_type = left_table->column_type(_column_ids.first);
+  Assert(data_type == right_table->column_type(_column_ids.second), "Join columns must have the same data type");
+  return data_type;
+}
+
+std::shared_ptr<const Table> AbstractJoinOperator::_build_output_table(
+    const std::shared_ptr<const PosList>& left_pos_list, const std::shared_ptr<const PosList>& right_pos_list) const {
+  DebugAssert(left_pos_list->size() == right_pos_list->size(), "Position lists of a join must have the same size");
+
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  auto output_table = std::make_shared<Table>();
+  for (const auto& input_table : {left_table, right_table}) {
+    for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+      output_table->add_column(input_table->column_name(column_id), input_table->column_type(column_id));
+    }
+  }
+  if (left_pos_list->empty()) return output_table;
+
+  auto output_chunk = Chunk{};
+  _add_reference_segments(left_table, left_pos_list, output_chunk);
+  _add_reference_segments(right_table, right_pos_list, output_chunk);
+  output_table->emplace_chunk(std::move(output_chunk));
+  return output_table;
+}
+
+}  // namespace opossum
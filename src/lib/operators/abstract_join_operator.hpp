@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * AbstractJoinOperator is the super class of all join operators. A join combines the rows of its left and right input
+ * for which `left_column <scan_type> right_column` holds. Its output has the columns of the left input followed by
+ * those of the right input, as ReferenceSegments that point to the stored tables (inputs that consist of
+ * ReferenceSegments themselves are resolved). Both join columns must have the same data type.
+ */
+class AbstractJoinOperator : public AbstractOperator {
+ public:
+  AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                       const std::shared_ptr<const AbstractOperator> right,
+                       const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+  // the join columns of the left and the right input
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+
+  ScanType scan_type() const;
+
+ protected:
+  // Checks that the join columns exist and have the same data type, and returns that type
+  const std::string& _join_column_type() const;
+
+  // Creates the output table from the matching pairs of rows, where left_pos_list[i] and right_pos_list[i] are the
+  // positions of the i-th pair in the left and right input
+  std::shared_ptr<const Table> _build_output_table(const std::shared_ptr<const PosList>& left_pos_list,
+                                                   const std::shared_ptr<const PosList>& right_pos_list) const;
+
+  const std::pair<ColumnID, ColumnID> _column_ids;
+  const ScanType _scan_type;
+};
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#include "abstract_operator.hpp"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
+                                   const std::shared_ptr<const AbstractOperator> right)
+    : _input_left{left}, _input_right{right} {}
+
+void AbstractOperator::execute() { _output = _on_execute(); }
+
+std::shared_ptr<const Table> AbstractOperator::get_output() const { return _output; }
+
+std::shared_ptr<const Table> AbstractOperator::_input_table_left() const {
+  Assert(_input_left && _input_left->get_output(), "Left input has not been executed");
+  return _input_left->get_output();
+}
+
+std::shared_ptr<const Table> AbstractOperator::_input_table_right() const {
+  Assert(_input_right && _input_right->get_output(), "Right input has not been executed");
+  return _input_right->get_output();
+}
+
+void AbstractOperator::_add_reference_segments(const std::shared_ptr<const Table>& input_table,
+                                               const std::shared_ptr<const PosList>& positions, Chunk& output_chunk) {
+  const auto column_count = input_table->column_count();
+  const auto chunk_count = input_table->chunk_count();
+
+  const auto& first_chunk = input_table->get_chunk(ChunkID{0});
+  const auto input_is_reference =
+      column_count > 0 && std::dynamic_pointer_cast<const ReferenceSegment>(first_chunk.get_segment(ColumnID{0}));
+  if (!input_is_reference) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, positions));
+    }
+    return;
+  }
+
+  auto resolved_positions_by_input = std::map<std::vector<std::shared_ptr<const PosList>>, std::shared_ptr<PosList>>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto input_pos_lists = std::vector<std::shared_ptr<const PosList>>{};
+    input_pos_lists.reserve(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto segment = input_table->get_chunk(chunk_id).get_segment(column_id);
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+      Assert(reference_segment, "Input tables must not mix ReferenceSegments with other segments");
+      input_pos_lists.emplace_back(reference_segment->pos_list());
+    }
+
+    auto& resolved_positions = resolved_positions_by_input[input_pos_lists];
+    if (!resolved_positions) {
+      resolved_positions = std::make_shared<PosList>();
+      resolved_positions->reserve(positions->size());
+      for (const auto& row_id : *positions) {
+        resolved_positions->emplace_back((*input_pos_lists[row_id.chunk_id])[row_id.chunk_offset]);
+      }
+    }
+
+    // all chunks of a column reference the same column of the same table
+    const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(first_chunk.get_segment(column_id));
+    output_chunk.add_segment(std::make_shared<ReferenceSegment>(
+        reference_segment->referenced_table(), reference_segment->referenced_column_id(), resolved_positions));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * AbstractOperator is the abstract super class for all operators. Operators form a tree: each operator has up to two
+ * input operators, whose outputs it reads after they have been executed. Calling execute() runs the operator (but not
+ * its inputs) and stores the result, which can then be retrieved with get_output():
+ *
+ *   auto get_table = std::make_shared<GetTable>("orders");
+ *   get_table->execute();
+ *   auto scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpEquals, 42);
+ *   scan->execute();
+ *   const auto result = scan->get_output();
+ *
+ * Operators are immutable after execution, so their output can be shared by several parent operators.
+ */
+class AbstractOperator : private Noncopyable {
+ public:
+  explicit AbstractOperator(const std::shared_ptr<const AbstractOperator> left = nullptr,
+                            const std::shared_ptr<const AbstractOperator> right = nullptr);
+
+  virtual ~AbstractOperator() = default;
+
+  // executes the operator, the inputs must have been executed before
+  void execute();
+
+  // returns the result of the operator, or nullptr if it has not been executed yet
+  std::shared_ptr<const Table> get_output() const;
+
+ protected:
+  // returns the outputs of the input operators
+  std::shared_ptr<const Table> _input_table_left() const;
+  std::shared_ptr<const Table> _input_table_right() const;
+
+  // implemented by the operators to compute their result
+  virtual std::shared_ptr<const Table> _on_execute() = 0;
+
+  // Adds one ReferenceSegment per column of the input table to the output chunk, referencing the rows at the given
+  // positions of the input. For inputs of ReferenceSegments, the positions are resolved through the position lists of
+  // the input segments, so that the output references the stored tables. Columns that share their position lists in
+  // the input share the resolved position list as well.
+  static void _add_reference_segments(const std::shared_ptr<const Table>& input_table,
+                                      const std::shared_ptr<const PosList>& positions, Chunk& output_chunk);
+
+  const std::shared_ptr<const AbstractOperator> _input_left;
+  const std::shared_ptr<const AbstractOperator> _input_right;
+
+  std::shared_ptr<const Table> _output;
+};
+
+}  // namespace opossum
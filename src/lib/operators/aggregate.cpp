@@ -0,0 +1,558 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/hash_utils.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace opossum {
+
+namespace {
+
+using GroupIndex = uint32_t;
+
+// Accumulates one aggregate for a set of groups, e.g., for the groups of a chunk
+class BaseAggregator {
+ public:
+  virtual ~BaseAggregator() = default;
+
+  // Adds the values of the segment to their groups, where group_indexes holds the group of each row. The groups must be
+  // numbered from 0 to group_count - 1 in the order of their first row.
+  virtual void aggregate(const BaseSegment& segment, const std::vector<GroupIndex>& group_indexes,
+                         const GroupIndex group_count) = 0;
+
+  // Merges the group other_group of another aggregator of the same kind into the given group, which is added if it is
+  // the next group
+  virtual void merge(const BaseAggregator& other, const GroupIndex other_group, const GroupIndex group) = 0;
+
+  // appends the result of each group to the column, which holds a vector of the result type of the aggregate
+  virtual void append_results(ColumnValues& column) const = 0;
+};
+
+template <typename T, AggregateFunction function>
+class Aggregator : public BaseAggregator {
+ public:
+  using SumType = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+  using ResultType = std::conditional_t<
+      function == AggregateFunction::Count, int64_t,
+      std::conditional_t<function == AggregateFunction::Sum, SumType,
+                         std::conditional_t<function == AggregateFunction::Avg, double, T>>>;
+
+  void aggregate(const BaseSegment& segment, const std::vector<GroupIndex>& group_indexes,
+                 const GroupIndex group_count) override {
+    if constexpr (function == AggregateFunction::Count) {
+      // there are no NULL values, so COUNT(column) does not need to look at the values
+      _counts.resize(group_count);
+      for (const auto group : group_indexes) ++_counts[group];
+      return;
+    }
+
+    const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment);
+
+    if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+      _sums.resize(group_count);
+      if constexpr (function == AggregateFunction::Avg) _counts.resize(group_count);
+      if (dictionary_segment && size_t{group_count} * dictionary_segment->unique_values_count() <= segment.size()) {
+        _sum_value_ids(*dictionary_segment, group_indexes, group_count);
+        return;
+      }
+
+      segment_iterate<T>(segment, [&](const ChunkOffset chunk_offset, const T value) {
+        const auto group = group_indexes[chunk_offset];
+        _sums[group] += value;
+        if constexpr (function == AggregateFunction::Avg) ++_counts[group];
+      });
+      return;
+    }
+
+    if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+      _values.reserve(group_count);
+      if (dictionary_segment) {
+        _select_value_ids(*dictionary_segment, group_indexes, group_count);
+        return;
+      }
+
+      segment_iterate<T>(segment, [&](const ChunkOffset chunk_offset, const auto& value) {
+        const auto group = group_indexes[chunk_offset];
+        // a group that is seen for the first time is the next one
+        if (group == _values.size()) {
+          _values.emplace_back(value);
+        } else if (_is_better(value, _values[group])) {
+          _values[group] = value;
+        }
+      });
+    }
+  }
+
+  void merge(const BaseAggregator& other, const GroupIndex other_group, const GroupIndex group) override {
+    const auto& other_aggregator = static_cast<const Aggregator&>(other);
+    const auto merge_value = [&](auto& values, const auto& other_value, const auto& combine) {
+      if (group == values.size()) {
+        values.push_back(other_value);
+      } else {
+        values[group] = combine(values[group], other_value);
+      }
+    };
+
+    if constexpr (function == AggregateFunction::Count || function == AggregateFunction::Avg) {
+      merge_value(_counts, other_aggregator._counts[other_group], std::plus<>{});
+    }
+    if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+      merge_value(_sums, other_aggregator._sums[other_group], std::plus<>{});
+    }
+    if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+      merge_value(_values, other_aggregator._values[other_group], [&](const T& value, const T& other_value) {
+        return _is_better(other_value, value) ? other_value : value;
+      });
+    }
+  }
+
+  void append_results(ColumnValues& column) const override {
+    auto& results = boost::get<pmr_vector<ResultType>>(column);
+    if constexpr (function == AggregateFunction::Count) results.insert(results.end(), _counts.cbegin(), _counts.cend());
+    if constexpr (function == AggregateFunction::Sum) results.insert(results.end(), _sums.cbegin(), _sums.cend());
+    if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+      results.insert(results.end(), _values.cbegin(), _values.cend());
+    }
+    if constexpr (function == AggregateFunction::Avg) {
+      for (auto group = size_t{0}; group < _sums.size(); ++group) {
+        results.push_back(static_cast<double>(_sums[group]) / static_cast<double>(_counts[group]));
+      }
+    }
+  }
+
+ protected:
+  // Counts the rows of each combination of group and ValueID in a dense array, so that each distinct value of a group
+  // is only decoded and added once. Used if the array is not larger than the segment, e.g., for low-cardinality
+  // columns.
+  void _sum_value_ids(const DictionarySegment<T>& segment, const std::vector<GroupIndex>& group_indexes,
+                      const GroupIndex group_count) {
+    const auto& dictionary = *segment.dictionary();
+    const auto value_count = dictionary.size();
+    auto value_id_counts = std::vector<uint32_t>(group_count * value_count);
+    attribute_vector_iterate(*segment.attribute_vector(), [&](const ChunkOffset chunk_offset, const ValueID value_id) {
+      ++value_id_counts[group_indexes[chunk_offset] * value_count + value_id];
+    });
+
+    for (auto group = GroupIndex{0}; group < group_count; ++group) {
+      for (auto value_id = size_t{0}; value_id < value_count; ++value_id) {
+        const auto count = value_id_counts[group * value_count + value_id];
+        _sums[group] += static_cast<SumType>(dictionary[value_id]) * count;
+        if constexpr (function == AggregateFunction::Avg) _counts[group] += count;
+      }
+    }
+  }
+
+  // Selects the minimum or maximum ValueID of each group. As the dictionary is sorted, it belongs to the minimum or
+  // maximum value, so only one value per group is decoded.
+  void _select_value_ids(const DictionarySegment<T>& segment, const std::vector<GroupIndex>& group_indexes,
+                         const GroupIndex group_count) {
+    // every group has a row in the chunk, so the initial ValueIDs are always replaced
+    constexpr auto initial_value_id =
+        function == AggregateFunction::Min ? std::numeric_limits<ValueID::base_type>::max() : ValueID::base_type{0};
+    auto value_ids = std::vector<ValueID::base_type>(group_count, initial_value_id);
+    attribute_vector_iterate(*segment.attribute_vector(), [&](const ChunkOffset chunk_offset, const ValueID value_id) {
+      auto& selected_value_id = value_ids[group_indexes[chunk_offset]];
+      if constexpr (function == AggregateFunction::Min) selected_value_id = std::min(selected_value_id, value_id.t);
+      if constexpr (function == AggregateFunction::Max) selected_value_id = std::max(selected_value_id, value_id.t);
+    });
+
+    const auto& dictionary = *segment.dictionary();
+    for (const auto value_id : value_ids) _values.push_back(dictionary[value_id]);
+  }
+
+  // whether value replaces current as the minimum or maximum
+  template <typename Value>
+  static bool _is_better(const Value& value, const T& current) {
+    if constexpr (function == AggregateFunction::Min) return value < current;
+    return current < value;
+  }
+
+  std::vector<int64_t> _counts;
+  std::vector<SumType> _sums;
+  std::vector<T> _values;
+};
+
+constexpr auto AGGREGATE_FUNCTION_NAMES = std::array<const char*, 5>{"COUNT", "SUM", "MIN", "MAX", "AVG"};
+
+std::string result_data_type(const AggregateFunction function, const std::string& column_type) {
+  switch (function) {
+    case AggregateFunction::Count:
+      return "long";
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+      return column_type;
+    case AggregateFunction::Sum:
+    case AggregateFunction::Avg:
+      Assert(column_type != "string", "SUM and AVG require a numeric column");
+      if (function == AggregateFunction::Sum && (column_type == "int" || column_type == "long")) return "long";
+      return "double";
+  }
+  Fail("Unknown aggregate function");
+  return "";
+}
+
+std::unique_ptr<BaseAggregator> make_aggregator(const AggregateFunction function, const std::string& column_type) {
+  // COUNT does not look at the values, so its type does not matter
+  if (function == AggregateFunction::Count) return std::make_unique<Aggregator<int32_t, AggregateFunction::Count>>();
+
+  auto aggregator = std::unique_ptr<BaseAggregator>{};
+  resolve_data_type(column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if (function == AggregateFunction::Min) {
+      aggregator = std::make_unique<Aggregator<ColumnDataType, AggregateFunction::Min>>();
+    }
+    if (function == AggregateFunction::Max) {
+      aggregator = std::make_unique<Aggregator<ColumnDataType, AggregateFunction::Max>>();
+    }
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      if (function == AggregateFunction::Sum) {
+        aggregator = std::make_unique<Aggregator<ColumnDataType, AggregateFunction::Sum>>();
+      }
+      if (function == AggregateFunction::Avg) {
+        aggregator = std::make_unique<Aggregator<ColumnDataType, AggregateFunction::Avg>>();
+      }
+    }
+  });
+  Assert(aggregator, "SUM and AVG require a numeric column");
+  return aggregator;
+}
+
+// the number of bits needed to store the numbers from 0 to count - 1
+uint8_t bits_for(const size_t count) {
+  auto bits = uint8_t{0};
+  while (bits < 64 && (uint64_t{1} << bits) < count) ++bits;
+  return bits;
+}
+
+// Keys of up to this many bits are numbered with an array indexed by the key instead of a hash map. The array then has
+// at most 64K entries and fits into the L2 cache.
+constexpr auto MAX_DENSE_KEY_BITS = uint8_t{16};
+
+// Replaces each key of key_bits bits with a dense id, numbered in the order of their first occurrence, and returns the
+// number of ids. keys and ids may be the same vector.
+template <typename Id>
+size_t densify(const std::vector<uint64_t>& keys, const uint8_t key_bits, std::vector<Id>& ids) {
+  ids.resize(keys.size());
+
+  // e.g., the ValueIDs of a dictionary segment, for which an array lookup replaces hashing
+  if (key_bits <= MAX_DENSE_KEY_BITS || (key_bits < 32 && (size_t{1} << key_bits) <= keys.size())) {
+    constexpr auto NO_ID = std::numeric_limits<Id>::max();
+    auto ids_by_key = std::vector<Id>(size_t{1} << key_bits, NO_ID);
+    auto id_count = size_t{0};
+    for (auto index = size_t{0}; index < keys.size(); ++index) {
+      auto& id = ids_by_key[keys[index]];
+      if (id == NO_ID) id = static_cast<Id>(id_count++);
+      ids[index] = id;
+    }
+    return id_count;
+  }
+
+  auto ids_by_key = std::unordered_map<uint64_t, Id>{};
+  for (auto index = size_t{0}; index < keys.size(); ++index) {
+    ids[index] = ids_by_key.try_emplace(keys[index], static_cast<Id>(ids_by_key.size())).first->second;
+  }
+  return ids_by_key.size();
+}
+
+// Writes an integer code for the value of each row of the segment to codes, such that equal values have equal codes,
+// and returns the number of bits of the codes
+uint8_t group_by_codes(const BaseSegment& segment, const std::string& data_type, std::vector<uint64_t>& codes) {
+  codes.resize(segment.size());
+  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
+    attribute_vector_iterate(*dictionary_segment->attribute_vector(),
+                             [&](const ChunkOffset chunk_offset, const ValueID value_id) {
+                               codes[chunk_offset] = value_id;
+                             });
+    return bits_for(dictionary_segment->unique_values_count());
+  }
+
+  auto bits = uint8_t{0};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    using ValueType = detail::IteratedValueType<ColumnDataType>;
+    if constexpr (std::is_integral_v<ColumnDataType>) {
+      using UnsignedType = std::make_unsigned_t<ColumnDataType>;
+      segment_iterate<ColumnDataType>(segment, [&](const ChunkOffset chunk_offset, const ColumnDataType value) {
+        codes[chunk_offset] = static_cast<UnsignedType>(value);
+      });
+      bits = sizeof(ColumnDataType) * 8;
+    } else {
+      auto ids = std::unordered_map<ValueType, uint64_t>{};
+      segment_iterate<ColumnDataType>(segment, [&](const ChunkOffset chunk_offset, const ValueType& value) {
+        codes[chunk_offset] = ids.try_emplace(value, ids.size()).first->second;
+      });
+      bits = bits_for(ids.size());
+    }
+  });
+  return bits;
+}
+
+// Computes the group of each row of a chunk, numbered in the order of their first row, and returns the number of
+// groups. The codes of the group-by columns are packed into one 64-bit key per row.
+GroupIndex group_rows(const Chunk& chunk, const std::vector<ColumnID>& column_ids,
+                      const std::vector<std::string>& data_types, std::vector<GroupIndex>& group_indexes) {
+  const auto row_count = chunk.size();
+  auto keys = std::vector<uint64_t>(row_count);
+  auto key_bits = uint8_t{0};
+  auto codes = std::vector<uint64_t>{};
+  for (auto index = size_t{0}; index < column_ids.size(); ++index) {
+    auto code_bits = group_by_codes(*chunk.get_segment(column_ids[index]), data_types[index], codes);
+    // a column with a single value does not split any group
+    if (code_bits == 0) continue;
+
+    // if the codes do not fit, the key and then the codes are replaced with dense ids, which need at most 32 bits
+    if (key_bits + code_bits > 64) key_bits = bits_for(densify(keys, key_bits, keys));
+    if (key_bits + code_bits > 64) code_bits = bits_for(densify(codes, code_bits, codes));
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      keys[chunk_offset] |= codes[chunk_offset] << key_bits;
+    }
+    key_bits += code_bits;
+  }
+
+  if (key_bits == 0) {
+    group_indexes.assign(row_count, GroupIndex{0});
+    return row_count > 0 ? 1 : 0;
+  }
+  return static_cast<GroupIndex>(densify(keys, key_bits, group_indexes));
+}
+
+// The values of the group-by columns of a group, either packed into a single integer (only for integer columns that
+// fit into 64 bits together) or one AllTypeVariant per column
+template <typename GroupKey>
+constexpr bool IS_PACKED_GROUP_KEY = std::is_same_v<GroupKey, uint64_t>;
+
+struct GroupKeyHash {
+  size_t operator()(const uint64_t key) const { return mix_hash(key); }
+
+  size_t operator()(const std::vector<AllTypeVariant>& key) const {
+    auto hash = uint64_t{0};
+    for (const auto& value : key) {
+      const auto value_hash = boost::apply_visitor(
+          [](const auto& typed_value) { return std::hash<std::decay_t<decltype(typed_value)>>{}(typed_value); }, value);
+      hash = mix_hash(hash ^ value_hash);
+    }
+    return hash;
+  }
+};
+
+// Collects the group key of each group of a chunk from the first row of the group
+template <typename GroupKey>
+std::vector<GroupKey> collect_group_keys(const Chunk& chunk, const std::vector<ColumnID>& column_ids,
+                                         const std::vector<std::string>& data_types,
+                                         const std::vector<GroupIndex>& group_indexes, const GroupIndex group_count) {
+  auto keys = std::vector<GroupKey>(group_count);
+  auto shift = uint8_t{0};
+  for (auto index = size_t{0}; index < column_ids.size(); ++index) {
+    resolve_data_type(data_types[index], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      auto next_group = GroupIndex{0};
+      segment_iterate<ColumnDataType>(
+          *chunk.get_segment(column_ids[index]), [&](const ChunkOffset chunk_offset, const auto& value) {
+            const auto group = group_indexes[chunk_offset];
+            if (group != next_group) return;
+            ++next_group;
+
+            if constexpr (!IS_PACKED_GROUP_KEY<GroupKey>) keys[group].emplace_back(ColumnDataType{value});
+            if constexpr (IS_PACKED_GROUP_KEY<GroupKey> && std::is_integral_v<ColumnDataType>) {
+              keys[group] |= uint64_t{static_cast<std::make_unsigned_t<ColumnDataType>>(value)} << shift;
+            }
+          });
+      if constexpr (std::is_integral_v<ColumnDataType>) shift += sizeof(ColumnDataType) * 8;
+    });
+  }
+  return keys;
+}
+
+// Appends the values of the group keys to the group-by columns
+template <typename GroupKey>
+void append_group_keys(const std::vector<GroupKey>& keys, const std::vector<std::string>& data_types,
+                       std::vector<ColumnValues>& columns) {
+  auto shift = uint8_t{0};
+  for (auto index = size_t{0}; index < data_types.size(); ++index) {
+    resolve_data_type(data_types[index], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      auto& values = boost::get<pmr_vector<ColumnDataType>>(columns[index]);
+      for (const auto& key : keys) {
+        if constexpr (!IS_PACKED_GROUP_KEY<GroupKey>) values.push_back(boost::get<ColumnDataType>(key[index]));
+        if constexpr (IS_PACKED_GROUP_KEY<GroupKey> && std::is_integral_v<ColumnDataType>) {
+          using UnsignedType = std::make_unsigned_t<ColumnDataType>;
+          values.push_back(static_cast<ColumnDataType>(static_cast<UnsignedType>(key >> shift)));
+        }
+      }
+      if constexpr (std::is_integral_v<ColumnDataType>) shift += sizeof(ColumnDataType) * 8;
+    });
+  }
+}
+
+// the groups and aggregates of a chunk or of a merge partition
+template <typename GroupKey>
+struct Groups {
+  std::vector<GroupKey> keys;
+  std::vector<std::unique_ptr<BaseAggregator>> aggregators;
+};
+
+template <typename GroupKey>
+void aggregate_table(const Table& table, const std::vector<AggregateColumnDefinition>& aggregates,
+                     const std::vector<ColumnID>& group_by_column_ids, const std::vector<std::string>& group_by_types,
+                     const std::vector<std::string>& aggregate_column_types, std::vector<ColumnValues>& columns) {
+  const auto make_aggregators = [&]() {
+    auto aggregators = std::vector<std::unique_ptr<BaseAggregator>>{};
+    for (auto index = size_t{0}; index < aggregates.size(); ++index) {
+      aggregators.emplace_back(make_aggregator(aggregates[index].function, aggregate_column_types[index]));
+    }
+    return aggregators;
+  };
+
+  // pre-aggregate each chunk and assign its groups to the merge partitions
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto partition_count = size_t{std::max(1u, std::thread::hardware_concurrency())};
+  auto chunk_groups = std::vector<Groups<GroupKey>>(chunk_count);
+  auto chunk_partitions = std::vector<std::vector<std::vector<GroupIndex>>>(chunk_count);
+  parallel_for(chunk_count, [&](const size_t chunk_index) {
+    const auto& chunk = table.get_chunk(ChunkID{static_cast<ChunkID::base_type>(chunk_index)});
+    auto group_indexes = std::vector<GroupIndex>{};
+    const auto group_count = group_rows(chunk, group_by_column_ids, group_by_types, group_indexes);
+
+    auto& groups = chunk_groups[chunk_index];
+    groups.keys = collect_group_keys<GroupKey>(chunk, group_by_column_ids, group_by_types, group_indexes, group_count);
+    groups.aggregators = make_aggregators();
+    for (auto index = size_t{0}; index < aggregates.size(); ++index) {
+      // COUNT(*) does not read a segment, so it is given any
+      const auto column_id = aggregates[index].column_id.value_or(ColumnID{0});
+      groups.aggregators[index]->aggregate(*chunk.get_segment(column_id), group_indexes, group_count);
+    }
+
+    auto& partitions = chunk_partitions[chunk_index];
+    partitions.resize(partition_count);
+    const auto hash = GroupKeyHash{};
+    for (auto group = GroupIndex{0}; group < group_count; ++group) {
+      partitions[hash(groups.keys[group]) % partition_count].push_back(group);
+    }
+  });
+
+  // merge the groups of all chunks, one partition of the groups at a time
+  auto partition_groups = std::vector<Groups<GroupKey>>(partition_count);
+  parallel_for(partition_count, [&](const size_t partition) {
+    auto& groups = partition_groups[partition];
+    groups.aggregators = make_aggregators();
+    auto group_by_key = std::unordered_map<GroupKey, GroupIndex, GroupKeyHash>{};
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+      const auto& local_groups = chunk_groups[chunk_index];
+      for (const auto local_group : chunk_partitions[chunk_index][partition]) {
+        const auto& key = local_groups.keys[local_group];
+        const auto next_group = static_cast<GroupIndex>(group_by_key.size());
+        const auto [entry, inserted] = group_by_key.try_emplace(key, next_group);  // NOLINT
+        if (inserted) groups.keys.push_back(key);
+        for (auto index = size_t{0}; index < aggregates.size(); ++index) {
+          groups.aggregators[index]->merge(*local_groups.aggregators[index], local_group, entry->second);
+        }
+      }
+    }
+  });
+
+  for (const auto& groups : partition_groups) {
+    append_group_keys(groups.keys, group_by_types, columns);
+    for (auto index = size_t{0}; index < aggregates.size(); ++index) {
+      groups.aggregators[index]->append_results(columns[group_by_column_ids.size() + index]);
+    }
+  }
+}
+
+}  // namespace
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator> in,
+                     const std::vector<AggregateColumnDefinition>& aggregates,
+                     const std::vector<ColumnID>& group_by_column_ids)
+    : AbstractOperator{in}, _aggregates{aggregates}, _group_by_column_ids{group_by_column_ids} {
+  Assert(!aggregates.empty() || !group_by_column_ids.empty(), "Aggregate needs aggregates or group-by columns");
+  for (const auto& aggregate : aggregates) {
+    Assert(aggregate.column_id || aggregate.function == AggregateFunction::Count,
+           "Only COUNT can be used without a column");
+  }
+}
+
+const std::vector<AggregateColumnDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& Aggregate::group_by_column_ids() const { return _group_by_column_ids; }
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto input_table = _input_table_left();
+  auto output_table = std::make_shared<Table>();
+  auto columns = std::vector<ColumnValues>{};
+  const auto add_output_column = [&](const std::string& name, const std::string& data_type) {
+    output_table->add_column(name, data_type);
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      columns.emplace_back(pmr_vector<ColumnDataType>{});
+    });
+  };
+
+  // integer group-by columns are packed into a single integer if they fit
+  auto group_by_types = std::vector<std::string>{};
+  auto group_key_bits = size_t{0};
+  for (const auto& column_id : _group_by_column_ids) {
+    Assert(column_id < input_table->column_count(), "Group-by column does not exist");
+    const auto& data_type = input_table->column_type(column_id);
+    group_by_types.push_back(data_type);
+    group_key_bits += data_type == "int" ? 32 : data_type == "long" ? 64 : 65;
+    add_output_column(input_table->column_name(column_id), data_type);
+  }
+
+  auto aggregate_column_types = std::vector<std::string>{};
+  for (const auto& aggregate : _aggregates) {
+    const auto function_name = std::string{AGGREGATE_FUNCTION_NAMES[static_cast<size_t>(aggregate.function)]};
+    if (!aggregate.column_id) {
+      aggregate_column_types.push_back("long");
+      add_output_column(function_name + "(*)", "long");
+      continue;
+    }
+
+    const auto column_id = *aggregate.column_id;
+    Assert(column_id < input_table->column_count(), "Aggregate column does not exist");
+    aggregate_column_types.push_back(input_table->column_type(column_id));
+    add_output_column(function_name + "(" + input_table->column_name(column_id) + ")",
+                      result_data_type(aggregate.function, aggregate_column_types.back()));
+  }
+
+  if (group_key_bits <= 64) {
+    aggregate_table<uint64_t>(*input_table, _aggregates, _group_by_column_ids, group_by_types, aggregate_column_types,
+                              columns);
+  } else {
+    aggregate_table<std::vector<AllTypeVariant>>(*input_table, _aggregates, _group_by_column_ids, group_by_types,
+                                                 aggregate_column_types, columns);
+  }
+
+  // Without group-by columns, an empty input still forms one group. As there are no NULL values, its aggregates other
+  // than COUNT are the default values of their types.
+  const auto group_count = boost::apply_visitor([](const auto& values) { return values.size(); }, columns.front());
+  if (group_count == 0 && _group_by_column_ids.empty()) {
+    for (auto& column : columns) {
+      boost::apply_visitor([](auto& values) { values.emplace_back(); }, column);
+    }
+  }
+
+  if (group_count > 0 || _group_by_column_ids.empty()) output_table->append_columns(std::move(columns));
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class AggregateFunction { Count, Sum, Min, Max, Avg };
+
+// An aggregate such as SUM(a). COUNT(*) is the only aggregate without a column.
+struct AggregateColumnDefinition {
+  std::optional<ColumnID> column_id;
+  AggregateFunction function;
+};
+
+/**
+ * Groups the rows of its input by the values of the group-by columns and computes the aggregates for each group. The
+ * output is a materialized table that has the group-by columns followed by one column per aggregate (named, e.g.,
+ * "SUM(a)" or "COUNT(*)"), with one row per group in no particular order. COUNT returns a long, AVG a double, SUM a
+ * long for integer columns and a double for floating-point columns, and MIN and MAX return the type of their column.
+ * Without group-by columns, all rows form a single group, so the output has exactly one row even for an empty input.
+ * Then, COUNT is 0 and, as there are no NULL values, the other aggregates are the default values of their types.
+ *
+ * The chunks are pre-aggregated in parallel, each into its own groups:
+ *
+ *  1. Group: the values of each group-by column are turned into integer codes (the ValueIDs of dictionary segments,
+ *     the values of integer columns, and otherwise ids assigned by a hash map), which are packed into a single 64-bit
+ *     key per row. If the codes of all columns do not fit into 64 bits, the key of the columns packed so far is first
+ *     replaced with a dense group id. Each row is then assigned the index of its group in the chunk, using an array
+ *     indexed by the key if the key has few bits (e.g., for low-cardinality dictionary segments) and a hash map
+ *     otherwise.
+ *  2. Aggregate: each aggregate is computed column by column, in a tight loop over the input segment that adds each
+ *     value to the accumulator of its group. For dictionary segments, MIN and MAX select the minimum or maximum
+ *     ValueID of each group, and SUM and AVG count the ValueIDs of each group in a dense array if there are few groups
+ *     and values. Only the final values of the groups are then decoded.
+ *
+ * The groups of the chunks are then merged in parallel, with the groups partitioned by the hash of their values. If
+ * all group-by columns are integer columns that fit into 64 bits together, the values of a group are packed into a
+ * single integer for the merge as well.
+ */
+class Aggregate : public AbstractOperator {
+ public:
+  Aggregate(const std::shared_ptr<const AbstractOperator> in, const std::vector<AggregateColumnDefinition>& aggregates,
+            const std::vector<ColumnID>& group_by_column_ids);
+
+  const std::vector<AggregateColumnDefinition>& aggregates() const;
+  const std::vector<ColumnID>& group_by_column_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<AggregateColumnDefinition> _aggregates;
+  const std::vector<ColumnID> _group_by_column_ids;
+};
+
+}  // namespace opossum
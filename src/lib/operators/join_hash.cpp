@@ -0,0 +1,232 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/hash_utils.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+struct JoinElement {
+  uint64_t hash;
+  T value;
+  RowID row_id;
+};
+
+// The elements of one input, ordered by partition. The elements of partition p are [offsets[p], offsets[p + 1]).
+// segments holds the segments that the values of string elements point into.
+template <typename T>
+struct RadixPartitions {
+  std::vector<JoinElement<T>> elements;
+  std::vector<size_t> offsets;
+  std::vector<std::shared_ptr<const BaseSegment>> segments;
+};
+
+// the partition of a hash is given by its upper radix_bits bits, the slots of the hash tables use the lower bits
+size_t partition_of(const uint64_t hash, const size_t radix_bits) {
+  return radix_bits == 0 ? 0 : static_cast<size_t>(hash >> (64 - radix_bits));
+}
+
+template <typename ColumnDataType>
+RadixPartitions<detail::IteratedValueType<ColumnDataType>> materialize_and_partition(const Table& table,
+                                                                                     const ColumnID column_id,
+                                                                                     const size_t radix_bits) {
+  using ValueType = detail::IteratedValueType<ColumnDataType>;
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto partition_count = size_t{1} << radix_bits;
+
+  // materialize the values of each chunk with their hashes, and count the elements of each partition per chunk
+  auto chunk_elements = std::vector<std::vector<JoinElement<ValueType>>>(chunk_count);
+  auto chunk_histograms = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count));
+  auto chunk_segments = std::vector<std::vector<std::shared_ptr<const BaseSegment>>>(chunk_count);
+  parallel_for(chunk_count, [&](const size_t chunk_index) {
+    const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_index)};
+    const auto segment = table.get_chunk(chunk_id).get_segment(column_id);
+    if constexpr (std::is_same_v<ColumnDataType, std::string>) chunk_segments[chunk_index] = iterated_segments(segment);
+    auto& elements = chunk_elements[chunk_index];
+    auto& histogram = chunk_histograms[chunk_index];
+    elements.reserve(segment->size());
+    segment_iterate<ColumnDataType>(*segment, [&](const ChunkOffset chunk_offset, const ValueType& value) {
+      const auto hash = mix_hash(std::hash<ValueType>{}(value));
+      elements.push_back({hash, value, RowID{chunk_id, chunk_offset}});
+      ++histogram[partition_of(hash, radix_bits)];
+    });
+  });
+
+  // the prefix sums over all partitions and chunks give each chunk its own write range in each partition
+  auto partitions = RadixPartitions<ValueType>{};
+  for (auto& segments : chunk_segments) {
+    partitions.segments.insert(partitions.segments.end(), segments.cbegin(), segments.cend());
+  }
+  partitions.offsets.resize(partition_count + 1);
+  auto chunk_write_positions = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count));
+  auto element_count = size_t{0};
+  for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+    partitions.offsets[partition] = element_count;
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+      chunk_write_positions[chunk_index][partition] = element_count;
+      element_count += chunk_histograms[chunk_index][partition];
+    }
+  }
+  partitions.offsets[partition_count] = element_count;
+
+  partitions.elements.resize(element_count);
+  parallel_for(chunk_count, [&](const size_t chunk_index) {
+    auto& write_positions = chunk_write_positions[chunk_index];
+    for (const auto& element : chunk_elements[chunk_index]) {
+      partitions.elements[write_positions[partition_of(element.hash, radix_bits)]++] = element;
+    }
+    // the materialized chunk is no longer needed
+    chunk_elements[chunk_index] = {};
+  });
+
+  return partitions;
+}
+
+// returns the number of radix bits needed for a build partition and its hash table to fit into the L2 cache
+template <typename T>
+size_t radix_bits_for(const size_t build_row_count) {
+  // besides the element and its RowID in the grouped build rows, each element needs two hash table slots, the index
+  // of its value, and one entry of the first element and of the row offset of its value at most
+  const auto build_bytes = build_row_count * (sizeof(JoinElement<T>) + sizeof(RowID) + 5 * sizeof(uint32_t));
+  auto radix_bits = size_t{0};
+  while (radix_bits < JoinHash::MAX_RADIX_BITS && (build_bytes >> radix_bits) > JoinHash::L2_CACHE_SIZE) ++radix_bits;
+  return radix_bits;
+}
+
+// Joins a build partition with a probe partition using an open-addressing hash table with linear probing. Each
+// distinct build value occupies a single slot, which stores the index of the value (offset by one, so that zero marks
+// an empty slot). The build rows are grouped by their value with a counting sort, so that a probe stops at the first
+// equal value and emits its contiguous range of build rows. Hence, duplicate build values do not lengthen the probe
+// sequences.
+template <typename T>
+void join_partition(const JoinElement<T>* build_elements, const size_t build_count,
+                    const JoinElement<T>* probe_elements, const size_t probe_count, PosList& build_pos_list,
+                    PosList& probe_pos_list) {
+  auto capacity = size_t{1};
+  while (capacity < 2 * build_count) capacity <<= 1;
+  const auto mask = capacity - 1;
+
+  // value_elements holds the first build element of each distinct value, value_row_offsets counts its rows
+  auto slots = std::vector<uint32_t>(capacity);
+  auto value_elements = std::vector<uint32_t>{};
+  auto value_row_offsets = std::vector<uint32_t>{0};
+
+  // returns the slot of the element's value, or the empty slot where it belongs
+  const auto find_slot = [&](const JoinElement<T>& element) {
+    auto slot = element.hash & mask;
+    while (slots[slot] != 0) {
+      const auto& value_element = build_elements[value_elements[slots[slot] - 1]];
+      if (value_element.hash == element.hash && value_element.value == element.value) break;
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  };
+
+  auto element_values = std::vector<uint32_t>(build_count);
+  for (auto build_index = size_t{0}; build_index < build_count; ++build_index) {
+    const auto slot = find_slot(build_elements[build_index]);
+    if (slots[slot] == 0) {
+      value_elements.emplace_back(static_cast<uint32_t>(build_index));
+      value_row_offsets.emplace_back(0);
+      slots[slot] = static_cast<uint32_t>(value_elements.size());
+    }
+    element_values[build_index] = slots[slot] - 1;
+    ++value_row_offsets[slots[slot]];
+  }
+
+  // the rows of value v are [value_row_offsets[v], value_row_offsets[v + 1]) of build_rows, in build order
+  std::partial_sum(value_row_offsets.cbegin(), value_row_offsets.cend(), value_row_offsets.begin());
+  auto write_positions = std::vector<uint32_t>(value_row_offsets.cbegin(), value_row_offsets.cend() - 1);
+  auto build_rows = PosList(build_count);
+  for (auto build_index = size_t{0}; build_index < build_count; ++build_index) {
+    build_rows[write_positions[element_values[build_index]]++] = build_elements[build_index].row_id;
+  }
+
+  for (auto probe_index = size_t{0}; probe_index < probe_count; ++probe_index) {
+    const auto& probe_element = probe_elements[probe_index];
+    const auto slot = find_slot(probe_element);
+    if (slots[slot] == 0) continue;
+
+    const auto value = slots[slot] - 1;
+    const auto rows_begin = value_row_offsets[value];
+    const auto rows_end = value_row_offsets[value + 1];
+    build_pos_list.insert(build_pos_list.end(), build_rows.cbegin() + rows_begin, build_rows.cbegin() + rows_end);
+    probe_pos_list.insert(probe_pos_list.end(), rows_end - rows_begin, probe_element.row_id);
+  }
+}
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right,
+                   const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractJoinOperator{left, right, column_ids, scan_type} {
+  Assert(scan_type == ScanType::OpEquals, "JoinHash only supports equi-joins");
+}
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  const auto& data_type = _join_column_type();
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  // the smaller input is used to build the hash tables
+  const auto build_left = left_table->row_count() <= right_table->row_count();
+  const auto& build_table = build_left ? *left_table : *right_table;
+  const auto& probe_table = build_left ? *right_table : *left_table;
+  const auto build_column_id = build_left ? _column_ids.first : _column_ids.second;
+  const auto probe_column_id = build_left ? _column_ids.second : _column_ids.first;
+
+  auto build_pos_list = std::make_shared<PosList>();
+  auto probe_pos_list = std::make_shared<PosList>();
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    using ValueType = detail::IteratedValueType<ColumnDataType>;
+
+    const auto radix_bits = radix_bits_for<ValueType>(build_table.row_count());
+    const auto build_partitions = materialize_and_partition<ColumnDataType>(build_table, build_column_id, radix_bits);
+    const auto probe_partitions = materialize_and_partition<ColumnDataType>(probe_table, probe_column_id, radix_bits);
+
+    const auto partition_count = size_t{1} << radix_bits;
+    auto partition_pos_lists = std::vector<std::pair<PosList, PosList>>(partition_count);
+    parallel_for(partition_count, [&](const size_t partition) {
+      const auto build_begin = build_partitions.offsets[partition];
+      const auto build_count = build_partitions.offsets[partition + 1] - build_begin;
+      const auto probe_begin = probe_partitions.offsets[partition];
+      const auto probe_count = probe_partitions.offsets[partition + 1] - probe_begin;
+      if (build_count == 0 || probe_count == 0) return;
+
+      join_partition(build_partitions.elements.data() + build_begin, build_count,
+                     probe_partitions.elements.data() + probe_begin, probe_count, partition_pos_lists[partition].first,
+                     partition_pos_lists[partition].second);
+    });
+
+    auto match_count = size_t{0};
+    for (const auto& pos_lists : partition_pos_lists) match_count += pos_lists.first.size();
+    build_pos_list->reserve(match_count);
+    probe_pos_list->reserve(match_count);
+    for (const auto& [partition_build_pos_list, partition_probe_pos_list] : partition_pos_lists) {  // NOLINT
+      build_pos_list->insert(build_pos_list->end(), partition_build_pos_list.cbegin(), partition_build_pos_list.cend());
+      probe_pos_list->insert(probe_pos_list->end(), partition_probe_pos_list.cbegin(), partition_probe_pos_list.cend());
+    }
+  });
+
+  if (build_left) return _build_output_table(build_pos_list, probe_pos_list);
+  return _build_output_table(probe_pos_list, build_pos_list);
+}
+
+}  // namespace opossum
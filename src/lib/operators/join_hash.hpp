@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Equi-join (ScanType::OpEquals only) that uses a radix-partitioned hash join:
+ *
+ *  1. Materialize: the join column of each input is read chunk by chunk in parallel, and each value is stored with
+ *     its hash and RowID.
+ *  2. Partition: both inputs are partitioned by the upper bits of the hash, with as many partitions as needed for a
+ *     partition of the smaller (build) input to fit into the L2 cache. Each chunk writes to precomputed ranges of the
+ *     partitions (histogram, prefix sum, scatter), so this step runs in parallel without synchronization, too.
+ *  3. Build and probe: for each pair of partitions, an open-addressing hash table with linear probing is built on
+ *     the build partition and probed with the probe partition. Each distinct build value has one slot, which points
+ *     to the contiguous range of its build rows, so that skewed join keys do not slow down the probes. The partitions
+ *     are processed in parallel, and each emits its own pair of PosLists, which are concatenated in the end.
+ */
+class JoinHash : public AbstractJoinOperator {
+ public:
+  JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+  // a conservative estimate of the per-core L2 cache size that a build partition (and its hash table) should fit into
+  static constexpr size_t L2_CACHE_SIZE = 256 * 1024;
+
+  // more partitions make the partitioning step itself less cache- and TLB-friendly
+  static constexpr size_t MAX_RADIX_BITS = 12;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,224 @@
+#include "join_sort_merge.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+struct SortedElement {
+  T value;
+  RowID row_id;
+};
+
+template <typename T>
+using SortedColumn = std::vector<SortedElement<T>>;
+
+template <typename T>
+bool value_less(const SortedElement<T>& lhs, const SortedElement<T>& rhs) {
+  return lhs.value < rhs.value;
+}
+
+// a piece [output_begin, output_end) of the merge of runs[2 * merged_index] and runs[2 * merged_index + 1]
+struct MergeTask {
+  size_t merged_index;
+  size_t output_begin;
+  size_t output_end;
+};
+
+// Returns how many of the first output_count elements of the merge of first and second stem from first. The merge is
+// stable (equal elements of first come before those of second), so the split is found by a binary search.
+template <typename T>
+size_t merge_split(const SortedColumn<T>& first, const SortedColumn<T>& second, const size_t output_count) {
+  auto low = output_count > second.size() ? output_count - second.size() : size_t{0};
+  auto high = std::min(output_count, first.size());
+  while (low < high) {
+    // too few elements are taken from first if first[middle] belongs before the last element taken from second
+    const auto middle = low + (high - low) / 2;
+    if (!value_less(second[output_count - middle - 1], first[middle])) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+// Materializes the join column of a table and sorts it by value. Equal values keep no particular order. The segments
+// that string values point into are added to segments.
+template <typename ColumnDataType>
+SortedColumn<detail::IteratedValueType<ColumnDataType>> materialize_and_sort(
+    const Table& table, const ColumnID column_id, std::vector<std::shared_ptr<const BaseSegment>>& segments) {
+  using ValueType = detail::IteratedValueType<ColumnDataType>;
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+
+  auto runs = std::vector<SortedColumn<ValueType>>(chunk_count);
+  auto chunk_segments = std::vector<std::vector<std::shared_ptr<const BaseSegment>>>(chunk_count);
+  parallel_for(chunk_count, [&](const size_t chunk_index) {
+    const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_index)};
+    const auto segment = table.get_chunk(chunk_id).get_segment(column_id);
+    if constexpr (std::is_same_v<ColumnDataType, std::string>) chunk_segments[chunk_index] = iterated_segments(segment);
+    auto& run = runs[chunk_index];
+    run.reserve(segment->size());
+    segment_iterate<ColumnDataType>(*segment, [&](const ChunkOffset chunk_offset, const ValueType& value) {
+      run.push_back({value, RowID{chunk_id, chunk_offset}});
+    });
+    if (!std::is_sorted(run.cbegin(), run.cend(), value_less<ValueType>)) {
+      std::sort(run.begin(), run.end(), value_less<ValueType>);
+    }
+  });
+  for (auto& chunk_segment_list : chunk_segments) {
+    segments.insert(segments.end(), chunk_segment_list.cbegin(), chunk_segment_list.cend());
+  }
+
+  // Merge neighbouring runs until a single run is left, each level halves the number of runs. Each merge is split into
+  // pieces of its output that are merged in parallel, so that the last levels, which merge only a few long runs, still
+  // use all threads.
+  const auto max_task_count = size_t{4} * std::max(1u, std::thread::hardware_concurrency());
+  while (runs.size() > 1) {
+    const auto merge_count = runs.size() / 2;
+    auto merged_runs = std::vector<SortedColumn<ValueType>>((runs.size() + 1) / 2);
+    if (runs.size() % 2 == 1) merged_runs.back() = std::move(runs.back());
+
+    auto tasks = std::vector<MergeTask>{};
+    for (auto merged_index = size_t{0}; merged_index < merge_count; ++merged_index) {
+      const auto merged_size = runs[2 * merged_index].size() + runs[2 * merged_index + 1].size();
+      merged_runs[merged_index].resize(merged_size);
+      const auto piece_count = std::min((max_task_count - 1) / merge_count + 1,
+                                        std::max(size_t{1}, merged_size / JoinSortMerge::MIN_MERGE_PARTITION_SIZE));
+      for (auto piece = size_t{0}; piece < piece_count; ++piece) {
+        tasks.push_back({merged_index, piece * merged_size / piece_count, (piece + 1) * merged_size / piece_count});
+      }
+    }
+
+    parallel_for(tasks.size(), [&](const size_t task_index) {
+      const auto& task = tasks[task_index];
+      const auto& first = runs[2 * task.merged_index];
+      const auto& second = runs[2 * task.merged_index + 1];
+      const auto first_begin = merge_split(first, second, task.output_begin);
+      const auto first_end = merge_split(first, second, task.output_end);
+      std::merge(first.cbegin() + first_begin, first.cbegin() + first_end,
+                 second.cbegin() + (task.output_begin - first_begin), second.cbegin() + (task.output_end - first_end),
+                 merged_runs[task.merged_index].begin() + task.output_begin, value_less<ValueType>);
+    });
+    runs = std::move(merged_runs);
+  }
+
+  if (runs.empty()) return {};
+  return std::move(runs.front());
+}
+
+// Joins the left elements [left_begin, left_end) with all right elements. For each left value, [lower, upper) are the
+// right elements that are equal to it. Both bounds only move forward, as the left values are visited in ascending
+// order.
+template <typename T>
+void merge_partition(const SortedColumn<T>& left, const size_t left_begin, const size_t left_end,
+                     const SortedColumn<T>& right, const ScanType scan_type, PosList& left_pos_list,
+                     PosList& right_pos_list) {
+  const auto right_begin = right.cbegin();
+  const auto right_end = right.cend();
+  auto lower = std::lower_bound(right_begin, right_end, left[left_begin], value_less<T>);
+  auto upper = lower;
+
+  const auto emit = [&](const RowID& left_row_id, const auto begin, const auto end) {
+    for (auto right_element = begin; right_element != end; ++right_element) {
+      left_pos_list.emplace_back(left_row_id);
+      right_pos_list.emplace_back(right_element->row_id);
+    }
+  };
+
+  for (auto left_index = left_begin; left_index < left_end; ++left_index) {
+    const auto& left_element = left[left_index];
+    // the bounds only need to be updated when the value changes
+    if (left_index == left_begin || left[left_index - 1].value < left_element.value) {
+      lower = upper;
+      while (lower != right_end && lower->value < left_element.value) ++lower;
+      upper = lower;
+      while (upper != right_end && !(left_element.value < upper->value)) ++upper;
+    }
+
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        emit(left_element.row_id, lower, upper);
+        break;
+      case ScanType::OpNotEquals:
+        emit(left_element.row_id, right_begin, lower);
+        emit(left_element.row_id, upper, right_end);
+        break;
+      case ScanType::OpLessThan:
+        emit(left_element.row_id, upper, right_end);
+        break;
+      case ScanType::OpLessThanEquals:
+        emit(left_element.row_id, lower, right_end);
+        break;
+      case ScanType::OpGreaterThan:
+        emit(left_element.row_id, right_begin, lower);
+        break;
+      case ScanType::OpGreaterThanEquals:
+        emit(left_element.row_id, right_begin, upper);
+        break;
+    }
+  }
+}
+
+}  // namespace
+
+JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator> left,
+                             const std::shared_ptr<const AbstractOperator> right,
+                             const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractJoinOperator{left, right, column_ids, scan_type} {}
+
+std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
+  const auto& data_type = _join_column_type();
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  auto left_pos_list = std::make_shared<PosList>();
+  auto right_pos_list = std::make_shared<PosList>();
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+    const auto left = materialize_and_sort<ColumnDataType>(*left_table, _column_ids.first, segments);
+    const auto right = materialize_and_sort<ColumnDataType>(*right_table, _column_ids.second, segments);
+    if (left.empty() || right.empty()) return;
+
+    // use a few more partitions than threads, so that partitions with many matches are balanced out
+    const auto max_partition_count = size_t{4} * std::max(1u, std::thread::hardware_concurrency());
+    const auto partition_count = std::min(max_partition_count, (left.size() - 1) / MIN_MERGE_PARTITION_SIZE + 1);
+    auto partition_pos_lists = std::vector<std::pair<PosList, PosList>>(partition_count);
+    parallel_for(partition_count, [&](const size_t partition) {
+      const auto left_begin = partition * left.size() / partition_count;
+      const auto left_end = (partition + 1) * left.size() / partition_count;
+      merge_partition(left, left_begin, left_end, right, _scan_type, partition_pos_lists[partition].first,
+                      partition_pos_lists[partition].second);
+    });
+
+    auto match_count = size_t{0};
+    for (const auto& pos_lists : partition_pos_lists) match_count += pos_lists.first.size();
+    left_pos_list->reserve(match_count);
+    right_pos_list->reserve(match_count);
+    for (const auto& [partition_left_pos_list, partition_right_pos_list] : partition_pos_lists) {  // NOLINT
+      left_pos_list->insert(left_pos_list->end(), partition_left_pos_list.cbegin(), partition_left_pos_list.cend());
+      right_pos_list->insert(right_pos_list->end(), partition_right_pos_list.cbegin(), partition_right_pos_list.cend());
+    }
+  });
+
+  return _build_output_table(left_pos_list, right_pos_list);
+}
+
+}  // namespace opossum
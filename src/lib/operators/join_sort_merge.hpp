@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Join that supports all ScanTypes by sorting both inputs on their join column and merging them:
+ *
+ *  1. Sort: the join column of each input is materialized and sorted chunk by chunk in parallel (chunks that are
+ *     already sorted, e.g., of timestamp columns, are only checked). The sorted chunks are then merged pairwise. Each
+ *     merge is split into pieces of its output, whose starts in both runs are found by a binary search, and all pieces
+ *     of a level are merged in parallel.
+ *  2. Merge: the sorted left input is split into ranges that are joined in parallel. Within a range, the left values
+ *     are visited in order, so the bounds of the equal right values only move forward. The matching right rows of a
+ *     left value are contiguous ranges before, at, or after these bounds (two ranges for OpNotEquals), so each match
+ *     costs constant time and no pair of rows is compared that does not match.
+ */
+class JoinSortMerge : public AbstractJoinOperator {
+ public:
+  JoinSortMerge(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+                const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+  // the minimum number of left rows joined by one task of the merge phase, and of rows merged by one task of the sort
+  static constexpr size_t MIN_MERGE_PARTITION_SIZE = 4'096;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,373 @@
+#include "sort.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/normalized_key.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the position and size of a sort column in the normalized keys
+struct KeyColumn {
+  ColumnID column_id;
+  std::string data_type;
+  size_t offset;
+  size_t size;
+  bool descending;
+  // the key only holds a prefix of the longer strings of the column, which are compared by value if the keys are equal
+  bool truncated;
+};
+
+// The normalized keys of the rows of a chunk, and the offsets of the rows in sorted order. For truncated string
+// columns, strings holds the values of the rows as well (one vector per key column, empty for other columns), and
+// segments the segments that they point into.
+struct SortedChunk {
+  std::vector<uint8_t> keys;
+  std::vector<ChunkOffset> order;
+  std::vector<std::vector<std::string_view>> strings;
+  std::vector<std::shared_ptr<const BaseSegment>> segments;
+};
+
+// returns the length of the longest string of a column
+size_t max_string_length(const Table& table, const ColumnID column_id) {
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  auto max_lengths = std::vector<size_t>(chunk_count);
+  parallel_for(chunk_count, [&](const size_t chunk_index) {
+    const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_index)};
+    const auto segment = table.get_chunk(chunk_id).get_segment(column_id);
+    auto& max_length = max_lengths[chunk_index];
+    // the dictionary holds each value of the segment once
+    if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<std::string>*>(segment.get())) {
+      for (const auto& value : *dictionary_segment->dictionary()) max_length = std::max(max_length, value.size());
+      return;
+    }
+    segment_iterate<std::string>(*segment, [&](const ChunkOffset, const std::string_view value) {
+      max_length = std::max(max_length, value.size());
+    });
+  });
+  return max_lengths.empty() ? 0 : *std::max_element(max_lengths.cbegin(), max_lengths.cend());
+}
+
+// writes the normalized keys of the rows of a chunk, key_size bytes per row, and the values of truncated columns
+void normalize_keys(const Chunk& chunk, const std::vector<KeyColumn>& key_columns, const size_t key_size,
+                    SortedChunk& sorted_chunk) {
+  const auto row_count = chunk.size();
+  auto& keys = sorted_chunk.keys;
+  keys.resize(row_count * key_size);
+  sorted_chunk.strings.resize(key_columns.size());
+  for (auto index = size_t{0}; index < key_columns.size(); ++index) {
+    const auto& key_column = key_columns[index];
+    const auto segment = chunk.get_segment(key_column.column_id);
+    resolve_data_type(key_column.data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        auto& strings = sorted_chunk.strings[index];
+        if (key_column.truncated) {
+          strings.resize(row_count);
+          const auto segments = iterated_segments(segment);
+          sorted_chunk.segments.insert(sorted_chunk.segments.end(), segments.cbegin(), segments.cend());
+        }
+        segment_iterate<ColumnDataType>(*segment, [&](const ChunkOffset chunk_offset, const std::string_view value) {
+          write_normalized_key_prefix(value, keys.data() + chunk_offset * key_size + key_column.offset,
+                                      key_column.size - 1);
+          if (key_column.truncated) strings[chunk_offset] = value;
+        });
+      } else {
+        segment_iterate<ColumnDataType>(*segment, [&](const ChunkOffset chunk_offset, const ColumnDataType value) {
+          write_normalized_key<ColumnDataType>(value, keys.data() + chunk_offset * key_size + key_column.offset);
+        });
+      }
+    });
+
+    if (key_column.descending) {
+      for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+        auto* key = keys.data() + chunk_offset * key_size + key_column.offset;
+        for (auto byte_index = size_t{0}; byte_index < key_column.size; ++byte_index) {
+          key[byte_index] = static_cast<uint8_t>(~key[byte_index]);
+        }
+      }
+    }
+  }
+}
+
+// Compares row lhs of lhs_chunk with row rhs of rhs_chunk like std::memcmp compares their keys, except that the values
+// of a truncated column decide if its prefixes are equal.
+int compare_rows(const SortedChunk& lhs_chunk, const ChunkOffset lhs, const SortedChunk& rhs_chunk,
+                 const ChunkOffset rhs, const std::vector<KeyColumn>& key_columns, const size_t key_size) {
+  const auto* lhs_key = lhs_chunk.keys.data() + size_t{lhs} * key_size;
+  const auto* rhs_key = rhs_chunk.keys.data() + size_t{rhs} * key_size;
+  auto compared_size = size_t{0};
+  for (auto index = size_t{0}; index < key_columns.size(); ++index) {
+    const auto& key_column = key_columns[index];
+    if (!key_column.truncated) continue;
+
+    const auto column_end = key_column.offset + key_column.size;
+    const auto comparison = std::memcmp(lhs_key + compared_size, rhs_key + compared_size, column_end - compared_size);
+    if (comparison != 0) return comparison;
+    compared_size = column_end;
+
+    const auto value_comparison = lhs_chunk.strings[index][lhs].compare(rhs_chunk.strings[index][rhs]);
+    if (value_comparison != 0) return (value_comparison < 0) != key_column.descending ? -1 : 1;
+  }
+  return std::memcmp(lhs_key + compared_size, rhs_key + compared_size, key_size - compared_size);
+}
+
+// Returns the offsets of the rows in the order of their keys. Rows with equal keys are ordered by their offset.
+std::vector<ChunkOffset> sort_keys(const SortedChunk& sorted_chunk, const std::vector<KeyColumn>& key_columns,
+                                   const size_t key_size) {
+  const auto& keys = sorted_chunk.keys;
+  const auto row_count = static_cast<ChunkOffset>(keys.size() / key_size);
+  auto order = std::vector<ChunkOffset>(row_count);
+  const auto truncated = std::any_of(key_columns.cbegin(), key_columns.cend(),
+                                     [](const KeyColumn& key_column) { return key_column.truncated; });
+
+  if (key_size <= sizeof(uint64_t)) {
+    // the keys are big-endian, so keys of up to eight bytes compare like integers (and have no truncated columns)
+    auto integer_keys = std::vector<std::pair<uint64_t, ChunkOffset>>(row_count);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      auto integer_key = uint64_t{0};
+      for (auto byte_index = size_t{0}; byte_index < key_size; ++byte_index) {
+        integer_key = (integer_key << 8) | keys[chunk_offset * key_size + byte_index];
+      }
+      integer_keys[chunk_offset] = {integer_key, chunk_offset};
+    }
+    std::sort(integer_keys.begin(), integer_keys.end());
+    for (auto index = size_t{0}; index < row_count; ++index) order[index] = integer_keys[index].second;
+    return order;
+  }
+
+  std::iota(order.begin(), order.end(), ChunkOffset{0});
+  if (truncated) {
+    std::sort(order.begin(), order.end(), [&](const ChunkOffset lhs, const ChunkOffset rhs) {
+      const auto comparison = compare_rows(sorted_chunk, lhs, sorted_chunk, rhs, key_columns, key_size);
+      return comparison < 0 || (comparison == 0 && lhs < rhs);
+    });
+    return order;
+  }
+
+  std::sort(order.begin(), order.end(), [&](const ChunkOffset lhs, const ChunkOffset rhs) {
+    const auto comparison = std::memcmp(keys.data() + lhs * key_size, keys.data() + rhs * key_size, key_size);
+    return comparison < 0 || (comparison == 0 && lhs < rhs);
+  });
+  return order;
+}
+
+// Merges the sorted chunks into the positions of all rows in sorted order. Rows with equal keys are ordered by their
+// chunk and then by their offset. The rows are split into parts by splitter rows that are sampled from the chunks. The
+// rows of a part are found in each chunk by a binary search, and the parts are merged in parallel with k-way merges.
+PosList merge_chunks(const std::vector<SortedChunk>& sorted_chunks, const std::vector<KeyColumn>& key_columns,
+                     const size_t key_size) {
+  const auto compare = [&](const RowID& lhs, const RowID& rhs) {
+    return compare_rows(sorted_chunks[lhs.chunk_id], lhs.chunk_offset, sorted_chunks[rhs.chunk_id], rhs.chunk_offset,
+                        key_columns, key_size);
+  };
+
+  const auto chunk_count = sorted_chunks.size();
+  auto row_count = size_t{0};
+  for (const auto& sorted_chunk : sorted_chunks) row_count += sorted_chunk.order.size();
+  const auto max_part_count = size_t{4} * std::max(1u, std::thread::hardware_concurrency());
+  const auto part_count = std::min(max_part_count, std::max(size_t{1}, row_count / Sort::MIN_MERGE_PARTITION_SIZE));
+
+  // part_count evenly spaced rows of each chunk are sampled, and the splitters evenly divide the sorted samples
+  auto samples = std::vector<RowID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count && part_count > 1; ++chunk_id) {
+    const auto& order = sorted_chunks[chunk_id].order;
+    if (order.empty()) continue;
+    for (auto sample = size_t{0}; sample < part_count; ++sample) {
+      samples.push_back({chunk_id, order[sample * order.size() / part_count]});
+    }
+  }
+  std::sort(samples.begin(), samples.end(), [&](const RowID& lhs, const RowID& rhs) { return compare(lhs, rhs) < 0; });
+  auto splitters = std::vector<RowID>{};
+  for (auto part = size_t{1}; part < part_count; ++part) {
+    splitters.push_back(samples[part * samples.size() / part_count]);
+  }
+
+  // part_bounds[chunk_id][part] is the index in the sorted order of the chunk where the part begins. Rows that are
+  // equal to a splitter all belong to the part that begins with it, so that they are merged by their chunk.
+  auto part_bounds = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(part_count + 1));
+  parallel_for(chunk_count, [&](const size_t chunk_index) {
+    const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_index)};
+    const auto& order = sorted_chunks[chunk_id].order;
+    auto& bounds = part_bounds[chunk_id];
+    for (auto part = size_t{1}; part < part_count; ++part) {
+      const auto bound = std::partition_point(order.cbegin(), order.cend(), [&](const ChunkOffset chunk_offset) {
+        return compare(RowID{chunk_id, chunk_offset}, splitters[part - 1]) < 0;
+      });
+      bounds[part] = static_cast<size_t>(bound - order.cbegin());
+    }
+    bounds[part_count] = order.size();
+  });
+
+  // each part writes its positions to its own range of the output
+  auto part_offsets = std::vector<size_t>(part_count + 1);
+  for (auto part = size_t{0}; part < part_count; ++part) {
+    part_offsets[part + 1] = part_offsets[part];
+    for (const auto& bounds : part_bounds) part_offsets[part + 1] += bounds[part + 1] - bounds[part];
+  }
+
+  auto positions = PosList(row_count);
+  parallel_for(part_count, [&](const size_t part) {
+    struct Cursor {
+      ChunkID chunk_id;
+      size_t index;
+      size_t end;
+    };
+    const auto row_of = [&](const Cursor& cursor) {
+      return RowID{cursor.chunk_id, sorted_chunks[cursor.chunk_id].order[cursor.index]};
+    };
+    // std::priority_queue returns the greatest element first, so the comparison is reversed
+    const auto comes_after = [&](const Cursor& lhs, const Cursor& rhs) {
+      const auto comparison = compare(row_of(lhs), row_of(rhs));
+      return comparison > 0 || (comparison == 0 && lhs.chunk_id > rhs.chunk_id);
+    };
+
+    auto cursors = std::priority_queue<Cursor, std::vector<Cursor>, decltype(comes_after)>{comes_after};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& bounds = part_bounds[chunk_id];
+      if (bounds[part] < bounds[part + 1]) cursors.push({chunk_id, bounds[part], bounds[part + 1]});
+    }
+
+    auto position = positions.begin() + part_offsets[part];
+    while (!cursors.empty()) {
+      auto cursor = cursors.top();
+      cursors.pop();
+      *position++ = row_of(cursor);
+      if (++cursor.index < cursor.end) cursors.push(cursor);
+    }
+  });
+  return positions;
+}
+
+// Copies the values of the input at the given positions into typed vectors, one per column. Each segment is read once
+// in its own order, and each value is written straight to the output rows of its input row.
+std::vector<ColumnValues> materialize_columns(const Table& table, const PosList& positions) {
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto column_count = static_cast<size_t>(table.column_count());
+
+  // output_rows[chunk_id][chunk_offset] is the output row of an input row
+  auto output_rows = std::vector<std::vector<size_t>>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    output_rows[chunk_id].resize(table.get_chunk(chunk_id).size());
+  }
+  const auto range_count = size_t{std::max(1u, std::thread::hardware_concurrency())};
+  parallel_for(range_count, [&](const size_t range) {
+    const auto range_end = (range + 1) * positions.size() / range_count;
+    for (auto output_row = range * positions.size() / range_count; output_row < range_end; ++output_row) {
+      output_rows[positions[output_row].chunk_id][positions[output_row].chunk_offset] = output_row;
+    }
+  });
+
+  auto columns = std::vector<ColumnValues>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      columns.emplace_back(pmr_vector<ColumnDataType>(positions.size()));
+    });
+  }
+
+  // each segment is copied by a separate task, and the tasks write to different rows of the columns
+  parallel_for(column_count * chunk_count, [&](const size_t task) {
+    const auto column_id = ColumnID{static_cast<ColumnID::base_type>(task / chunk_count)};
+    const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(task % chunk_count)};
+    const auto segment = table.get_chunk(chunk_id).get_segment(column_id);
+    const auto& chunk_output_rows = output_rows[chunk_id];
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      auto& values = boost::get<pmr_vector<ColumnDataType>>(columns[column_id]);
+      segment_iterate<ColumnDataType>(*segment, [&](const ChunkOffset chunk_offset, const auto& value) {
+        values[chunk_output_rows[chunk_offset]] = ColumnDataType(value);
+      });
+    });
+  });
+  return columns;
+}
+
+}  // namespace
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_columns,
+           const SortOutputMode output_mode)
+    : AbstractOperator{in}, _sort_columns{sort_columns}, _output_mode{output_mode} {
+  Assert(!sort_columns.empty(), "Sort needs at least one sort column");
+}
+
+const std::vector<SortColumnDefinition>& Sort::sort_columns() const { return _sort_columns; }
+
+SortOutputMode Sort::output_mode() const { return _output_mode; }
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  auto key_columns = std::vector<KeyColumn>{};
+  auto key_size = size_t{0};
+  for (const auto& sort_column : _sort_columns) {
+    Assert(sort_column.column_id < input_table->column_count(), "Sort column does not exist");
+    const auto& data_type = input_table->column_type(sort_column.column_id);
+    auto size = size_t{0};
+    auto truncated = false;
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        // the prefix is followed by the length byte, so that no key is a prefix of another key
+        const auto max_length = max_string_length(*input_table, sort_column.column_id);
+        truncated = max_length > STRING_PREFIX_SIZE;
+        size = std::min(max_length, STRING_PREFIX_SIZE) + 1;
+      } else {
+        size = sizeof(ColumnDataType);
+      }
+    });
+    key_columns.push_back({sort_column.column_id, data_type, key_size, size,
+                           sort_column.order == SortOrder::Descending, truncated});
+    key_size += size;
+  }
+
+  const auto chunk_count = static_cast<size_t>(input_table->chunk_count());
+  auto sorted_chunks = std::vector<SortedChunk>(chunk_count);
+  parallel_for(chunk_count, [&](const size_t chunk_index) {
+    const auto& chunk = input_table->get_chunk(ChunkID{static_cast<ChunkID::base_type>(chunk_index)});
+    auto& sorted_chunk = sorted_chunks[chunk_index];
+    normalize_keys(chunk, key_columns, key_size, sorted_chunk);
+    sorted_chunk.order = sort_keys(sorted_chunk, key_columns, key_size);
+  });
+  auto positions = std::make_shared<PosList>(merge_chunks(sorted_chunks, key_columns, key_size));
+
+  // the references are stored in a single chunk, like the outputs of joins
+  const auto materialize = _output_mode == SortOutputMode::Materialized;
+  auto output_table = materialize ? std::make_shared<Table>(input_table->max_chunk_size()) : std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  if (positions->empty()) return output_table;
+
+  if (materialize) {
+    // intermediate results are not worth encoding
+    output_table->set_background_encoding(false);
+    output_table->append_columns(materialize_columns(*input_table, *positions));
+    return output_table;
+  }
+
+  auto output_chunk = Chunk{};
+  _add_reference_segments(input_table, positions, output_chunk);
+  output_table->emplace_chunk(std::move(output_chunk));
+  return output_table;
+}
+
+}  // namespace opossum
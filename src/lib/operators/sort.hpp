@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class SortOrder { Ascending, Descending };
+
+struct SortColumnDefinition {
+  ColumnID column_id;
+  SortOrder order;
+};
+
+// References outputs one chunk of ReferenceSegments, Materialized copies the values into a new table
+enum class SortOutputMode { References, Materialized };
+
+/**
+ * Sorts its input by one or more columns, each ascending or descending. Rows with equal values in all sort columns
+ * keep their order of the input, i.e., the sort is stable.
+ *
+ *  1. Normalize: for each row, the values of the sort columns are encoded into a fixed-size binary key (see
+ *     utils/normalized_key.hpp; strings are stored as a prefix of at most STRING_PREFIX_SIZE bytes, padded to the
+ *     longest string of their column, and a length byte, and the bytes of descending columns are inverted). Comparing
+ *     two rows then is a single memcmp, regardless of the number and types of the sort columns. Only if the prefixes
+ *     of strings that are longer than STRING_PREFIX_SIZE are equal, the strings themselves are compared.
+ *  2. Sort: each chunk sorts its rows by their keys in parallel. Keys of up to eight bytes are compared as integers.
+ *  3. Merge: the rows are split into parts by splitter keys sampled from the sorted chunks, and the rows of each part
+ *     are merged from all chunks with a k-way merge, with the parts merged in parallel.
+ *
+ * Materialized outputs are copied segment by segment, with each value written straight to its output row.
+ *
+ * The output has the columns of the input, either as ReferenceSegments that point to the stored tables or, if
+ * materialized, as ValueSegments in chunks of the input's maximum chunk size.
+ */
+class Sort : public AbstractOperator {
+ public:
+  Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_columns,
+       const SortOutputMode output_mode = SortOutputMode::References);
+
+  const std::vector<SortColumnDefinition>& sort_columns() const;
+  SortOutputMode output_mode() const;
+
+  // the maximum number of bytes of a string that are stored in the normalized keys
+  static constexpr size_t STRING_PREFIX_SIZE = 15;
+
+  // the minimum number of rows merged by one task of the merge phase
+  static constexpr size_t MIN_MERGE_PARTITION_SIZE = 4'096;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<SortColumnDefinition> _sort_columns;
+  const SortOutputMode _output_mode;
+};
+
+}  // namespace opossum
@@ -0,0 +1,389 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto SCAN_BLOCK_SIZE = ChunkOffset{128};
+
+// Scans values block-wise, where get_block(block_begin, block_size) returns a pointer to the values of a block. The
+// predicate evaluations of a block have no branches and no dependencies between iterations, so the compiler turns them
+// into SIMD comparisons (e.g., eight int32_t or 32 uint8_t per AVX2 instruction when built with -march=native). The
+// matching offsets of a block are then written without branches into a buffer of one block, which is appended to the
+// matches, so that the matches never occupy more than they need for selective scans. Blocks without any match are
+// skipped entirely, which makes selective scans run at memory bandwidth.
+template <typename GetBlock, typename Predicate>
+void scan_blocks(const ChunkOffset size, const GetBlock& get_block, const Predicate& predicate,
+                 std::vector<ChunkOffset>& matches) {
+  auto block_matches = std::array<uint8_t, SCAN_BLOCK_SIZE>{};
+  auto block_offsets = std::array<ChunkOffset, SCAN_BLOCK_SIZE>{};
+
+  for (auto block_begin = ChunkOffset{0}; block_begin < size; block_begin += SCAN_BLOCK_SIZE) {
+    const auto block_size = std::min(SCAN_BLOCK_SIZE, size - block_begin);
+    const auto* const block_values = get_block(block_begin, block_size);
+
+    auto any_match = uint8_t{0};
+    for (auto index = ChunkOffset{0}; index < block_size; ++index) {
+      block_matches[index] = predicate(block_values[index]);
+      any_match |= block_matches[index];
+    }
+    if (!any_match) continue;
+
+    auto match_count = size_t{0};
+    for (auto index = ChunkOffset{0}; index < block_size; ++index) {
+      block_offsets[match_count] = block_begin + index;
+      match_count += block_matches[index];
+    }
+    matches.insert(matches.end(), block_offsets.cbegin(), block_offsets.cbegin() + match_count);
+  }
+}
+
+// scans contiguous values, e.g., those of a ValueSegment
+template <typename T, typename Predicate>
+void scan_values(const T* values, const ChunkOffset size, const Predicate& predicate,
+                 std::vector<ChunkOffset>& matches) {
+  scan_blocks(
+      size, [&](const ChunkOffset block_begin, const ChunkOffset) { return values + block_begin; }, predicate,
+      matches);
+}
+
+// Scans a dictionary segment on its value ids only. The search value is translated into a range of matching value ids
+// once, using the sorted dictionary, so that each row costs a single integer comparison of its 1, 2, or 4 byte code.
+// No value is ever decoded.
+void scan_dictionary_segment(const BaseDictionarySegment& segment, const ScanType scan_type,
+                             const AllTypeVariant& search_value, std::vector<ChunkOffset>& matches) {
+  const auto& attribute_vector = *segment.attribute_vector();
+  const auto size = static_cast<ChunkOffset>(attribute_vector.size());
+  const auto unique_values_count = static_cast<ValueID::base_type>(segment.unique_values_count());
+
+  // INVALID_VALUE_ID means that the bound lies behind the last value id
+  const auto to_bound = [&](const ValueID value_id) {
+    return value_id == INVALID_VALUE_ID ? unique_values_count : ValueID::base_type{value_id};
+  };
+  const auto lower_bound = to_bound(segment.lower_bound(search_value));
+  const auto upper_bound = to_bound(segment.upper_bound(search_value));
+
+  // the matching value ids are [range_begin, range_end), or all others for OpNotEquals
+  auto range_begin = ValueID::base_type{0};
+  auto range_end = unique_values_count;
+  switch (scan_type) {
+    case ScanType::OpEquals:
+    case ScanType::OpNotEquals:
+      range_begin = lower_bound;
+      range_end = upper_bound;
+      break;
+    case ScanType::OpLessThan:
+      range_end = lower_bound;
+      break;
+    case ScanType::OpLessThanEquals:
+      range_end = upper_bound;
+      break;
+    case ScanType::OpGreaterThan:
+      range_begin = upper_bound;
+      break;
+    case ScanType::OpGreaterThanEquals:
+      range_begin = lower_bound;
+      break;
+  }
+  const auto negate = scan_type == ScanType::OpNotEquals;
+
+  // if no value id or all value ids match, the attribute vector does not have to be read
+  const auto range_is_empty = range_begin >= range_end;
+  const auto range_is_complete = range_begin == 0 && range_end == unique_values_count;
+  if (negate ? range_is_complete : range_is_empty) return;
+  if (negate ? range_is_empty : range_is_complete) {
+    matches.resize(size);
+    std::iota(matches.begin(), matches.end(), ChunkOffset{0});
+    return;
+  }
+
+  // Otherwise, range_begin and range_width are smaller than unique_values_count, so they fit into the type of the
+  // codes. Unsigned overflow turns the range check into a single comparison.
+  const auto range_width = range_end - range_begin;
+  const auto scan_fitted = [&](const auto& codes) {
+    using CodeType = typename std::decay_t<decltype(codes)>::value_type;
+    const auto code_begin = static_cast<CodeType>(range_begin);
+    const auto code_width = static_cast<CodeType>(range_width);
+    scan_values(
+        codes.data(), size,
+        [=](const CodeType code) { return (static_cast<CodeType>(code - code_begin) < code_width) != negate; },
+        matches);
+  };
+
+  if (const auto* fitted = dynamic_cast<const FittedAttributeVector<uint8_t>*>(&attribute_vector)) {
+    scan_fitted(fitted->values());
+  } else if (const auto* fitted = dynamic_cast<const FittedAttributeVector<uint16_t>*>(&attribute_vector)) {
+    scan_fitted(fitted->values());
+  } else if (const auto* fitted = dynamic_cast<const FittedAttributeVector<uint32_t>*>(&attribute_vector)) {
+    scan_fitted(fitted->values());
+  } else {
+    // other attribute vectors (i.e., bit-packed ones) are unpacked block by block
+    auto block = std::array<ValueID, SCAN_BLOCK_SIZE>{};
+    scan_blocks(
+        size,
+        [&](const ChunkOffset block_begin, const ChunkOffset block_size) {
+          attribute_vector.unpack(block_begin, block_size, block.data());
+          return block.data();
+        },
+        [=](const ValueID value_id) { return (value_id - range_begin < range_width) != negate; }, matches);
+  }
+}
+
+// scans any segment type through segment_iterate, also without branches per value
+template <typename T, typename Comparator>
+void scan_segment(const BaseSegment& segment, const detail::IteratedValueType<T>& search_value,
+                  const Comparator& comparator, std::vector<ChunkOffset>& matches) {
+  // as in scan_blocks(), the matches are collected in a buffer of one block first
+  auto block_offsets = std::array<ChunkOffset, SCAN_BLOCK_SIZE>{};
+  auto match_count = size_t{0};
+  segment_iterate<T>(segment, [&](const ChunkOffset chunk_offset, const auto& value) {
+    block_offsets[match_count] = chunk_offset;
+    match_count += comparator(value, search_value);
+    if (match_count == SCAN_BLOCK_SIZE) {
+      matches.insert(matches.end(), block_offsets.cbegin(), block_offsets.cend());
+      match_count = 0;
+    }
+  });
+  matches.insert(matches.end(), block_offsets.cbegin(), block_offsets.cbegin() + match_count);
+}
+
+// Converts `value <scan_type> search_value` into a comparison with a search value of type T that selects the same
+// values. The search value is rounded up (see ceil_cast), so that, e.g., `int_value < 3.5` becomes `int_value < 4`
+// rather than `int_value < 3`. If the predicate holds for all or for no values of T, that result is returned instead.
+template <typename T>
+std::variant<bool, std::pair<ScanType, T>> cast_predicate(const ScanType scan_type,
+                                                          const AllTypeVariant& search_value) {
+  const auto cast_value = ceil_cast<T>(search_value);
+  if (!cast_value) {
+    // the search value is greater than all values
+    return scan_type == ScanType::OpNotEquals || scan_type == ScanType::OpLessThan ||
+           scan_type == ScanType::OpLessThanEquals;
+  }
+
+  const auto& [value, exact] = *cast_value;
+  if (exact) return std::pair{scan_type, value};
+
+  // no value lies between the search value and the next greater value
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return false;
+    case ScanType::OpNotEquals:
+      return true;
+    case ScanType::OpLessThan:
+    case ScanType::OpLessThanEquals:
+      return std::pair{ScanType::OpLessThan, value};
+    case ScanType::OpGreaterThan:
+    case ScanType::OpGreaterThanEquals:
+      return std::pair{ScanType::OpGreaterThanEquals, value};
+  }
+  Fail("Unknown scan type");
+  return false;
+}
+
+// Creates a chunk of ReferenceSegments for the matching rows of an input chunk, given as their positions in the input
+// table. Segments that store data reference the input table through these positions. ReferenceSegments are resolved,
+// so that the output references the same tables as the input and never another ReferenceSegment. Output segments that
+// stem from the same position list share one position list.
+Chunk create_reference_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                             const std::shared_ptr<const PosList>& positions) {
+  const auto& input_chunk = input_table->get_chunk(chunk_id);
+  auto output_chunk = Chunk{};
+
+  auto resolved_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+  for (auto column_id = ColumnID{0}; column_id < input_chunk.column_count(); ++column_id) {
+    const auto segment = input_chunk.get_segment(column_id);
+
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      auto& resolved_pos_list = resolved_pos_lists[reference_segment->pos_list()];
+      if (!resolved_pos_list) {
+        const auto& referenced_positions = *reference_segment->pos_list();
+        resolved_pos_list = std::make_shared<PosList>();
+        resolved_pos_list->reserve(positions->size());
+        for (const auto& position : *positions) {
+          resolved_pos_list->emplace_back(referenced_positions[position.chunk_offset]);
+        }
+      }
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(
+          reference_segment->referenced_table(), reference_segment->referenced_column_id(), resolved_pos_list));
+      continue;
+    }
+
+    output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, positions));
+  }
+
+  return output_chunk;
+}
+
+}  // namespace
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
+                     const ScanType scan_type, const AllTypeVariant search_value)
+    : AbstractOperator{in}, _column_id{column_id}, _scan_type{scan_type}, _search_value{search_value} {}
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+std::shared_ptr<const PosList> TableScan::pos_list() const {
+  if (!get_output()) return nullptr;
+
+  std::call_once(_pos_list_flag, [&]() {
+    auto pos_list = std::make_shared<PosList>();
+    for (const auto& chunk_pos_list : _chunk_pos_lists) {
+      pos_list->insert(pos_list->end(), chunk_pos_list->cbegin(), chunk_pos_list->cend());
+    }
+    _pos_list = pos_list;
+  });
+  return _pos_list;
+}
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(_column_id < input_table->column_count(), "TableScan: Column does not exist");
+
+  const auto column_count = input_table->column_count();
+  const auto chunk_count = static_cast<size_t>(input_table->chunk_count());
+  const auto& data_type = input_table->column_type(_column_id);
+
+  // Each chunk is scanned by a separate task, which also creates the output chunk referencing the matching rows. The
+  // offsets of the matches are dropped as soon as they are turned into positions, which are stored only once: they
+  // are shared by the output segments that reference the input table and pos_list() is built from them on demand.
+  auto chunk_pos_lists = std::vector<std::shared_ptr<const PosList>>(chunk_count);
+  auto output_chunks = std::vector<Chunk>(chunk_count);
+  parallel_for(chunk_count, [&](const size_t chunk_index) {
+    const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_index)};
+    const auto matches = _scan_chunk(input_table->get_chunk(chunk_id), data_type);
+    if (matches.empty()) return;
+
+    auto positions = std::make_shared<PosList>();
+    positions->reserve(matches.size());
+    for (const auto chunk_offset : matches) {
+      positions->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+    output_chunks[chunk_index] = create_reference_chunk(input_table, chunk_id, positions);
+    chunk_pos_lists[chunk_index] = std::move(positions);
+  });
+
+  auto output_table = std::make_shared<Table>(input_table->max_chunk_size());
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  _chunk_pos_lists.clear();
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+    if (!chunk_pos_lists[chunk_index]) continue;
+
+    _chunk_pos_lists.emplace_back(std::move(chunk_pos_lists[chunk_index]));
+    output_table->emplace_chunk(std::move(output_chunks[chunk_index]));
+  }
+
+  return output_table;
+}
+
+std::vector<ChunkOffset> TableScan::_scan_chunk(const Chunk& chunk, const std::string& data_type) const {
+  if (chunk.size() == 0 || chunk.can_prune(_column_id, _scan_type, _search_value)) return {};
+
+  if (auto index_matches = _scan_index(chunk)) return std::move(*index_matches);
+
+  auto matches = std::vector<ChunkOffset>{};
+  const auto segment = chunk.get_segment(_column_id);
+  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(segment.get())) {
+    scan_dictionary_segment(*dictionary_segment, _scan_type, _search_value, matches);
+    return matches;
+  }
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto predicate = cast_predicate<ColumnDataType>(_scan_type, _search_value);
+    if (const auto* const all_match = std::get_if<bool>(&predicate)) {
+      if (*all_match) {
+        matches.resize(chunk.size());
+        std::iota(matches.begin(), matches.end(), ChunkOffset{0});
+      }
+      return;
+    }
+    const auto scan_type = std::get<1>(predicate).first;
+    const auto typed_search_value = std::get<1>(predicate).second;
+
+    with_comparator(scan_type, [&](auto comparator) {
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        if (const auto* value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(segment.get())) {
+          const auto& values = value_segment->values();
+          scan_values(
+              values.data(), static_cast<ChunkOffset>(values.size()),
+              [&](const ColumnDataType value) { return comparator(value, typed_search_value); }, matches);
+          return;
+        }
+      }
+      scan_segment<ColumnDataType>(*segment, typed_search_value, comparator, matches);
+    });
+  });
+  return matches;
+}
+
+std::optional<std::vector<ChunkOffset>> TableScan::_scan_index(const Chunk& chunk) const {
+  // an index cannot skip the rows of a single value, so OpNotEquals scans the segment
+  if (_scan_type == ScanType::OpNotEquals) return std::nullopt;
+
+  const auto indexes = chunk.get_indexes(std::vector<ColumnID>{_column_id});
+  if (indexes.empty()) return std::nullopt;
+  const auto& index = *indexes.front();
+
+  auto begin = index.cbegin();
+  auto end = index.cend();
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      begin = index.lower_bound({_search_value});
+      end = index.upper_bound({_search_value});
+      break;
+    case ScanType::OpLessThan:
+      end = index.lower_bound({_search_value});
+      break;
+    case ScanType::OpLessThanEquals:
+      end = index.upper_bound({_search_value});
+      break;
+    case ScanType::OpGreaterThan:
+      begin = index.upper_bound({_search_value});
+      break;
+    case ScanType::OpGreaterThanEquals:
+      begin = index.lower_bound({_search_value});
+      break;
+    default:
+      Fail("Unsupported scan type for index scans");
+  }
+
+  // the index orders the positions by value, but the output is ordered by position
+  auto matches = std::vector<ChunkOffset>(begin, end);
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * Selects all rows of the input table for which `column <scan_type> search_value` holds. The search value is
+ * converted to the type of the column without rounding it down (see ceil_cast), so that, e.g., `int_column < 3.5`
+ * selects 3.
+ *
+ * The chunks are scanned in parallel. For each chunk, the scan
+ *
+ *  - skips the chunk if its segment statistics show that no row can match (see Chunk::can_prune),
+ *  - uses an index on the column for all scan types except OpNotEquals, if the chunk has one,
+ *  - compares only the value ids of dictionary segments, against a range of value ids computed once per segment,
+ *  - and otherwise compares the values of the segment in a tight loop that is specialized for the data type, the
+ *    comparison, and the segment type. For numeric value segments, the comparisons are vectorized.
+ *
+ * The output table does not copy any values. For each input chunk with matches, it has a chunk of ReferenceSegments
+ * that point to the matching rows. If the input already consists of ReferenceSegments (e.g., in chained scans), the
+ * output references the same tables as the input. The positions of all matching rows in the input table are available
+ * as a PosList through pos_list(), ordered by chunk and offset. It is only built when it is requested.
+ */
+class TableScan : public AbstractOperator {
+ public:
+  TableScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const ScanType scan_type,
+            const AllTypeVariant search_value);
+
+  ColumnID column_id() const;
+  ScanType scan_type() const;
+  const AllTypeVariant& search_value() const;
+
+  // Returns the positions of all matching rows in the input table, or nullptr if the scan has not been executed yet.
+  // The list is copied from the positions of the output chunks on the first call.
+  std::shared_ptr<const PosList> pos_list() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // returns the offsets of all matching rows of the given chunk, in ascending order
+  std::vector<ChunkOffset> _scan_chunk(const Chunk& chunk, const std::string& data_type) const;
+
+  // returns the offsets of matching rows by looking them up in the index, or std::nullopt if there is no index
+  std::optional<std::vector<ChunkOffset>> _scan_index(const Chunk& chunk) const;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+
+  // the positions of the matching rows of each input chunk with matches
+  std::vector<std::shared_ptr<const PosList>> _chunk_pos_lists;
+
+  mutable std::once_flag _pos_list_flag;
+  mutable std::shared_ptr<const PosList> _pos_list;
+};
+
+}  // namespace opossum
@@ -0,0 +1,106 @@
+#include "column_statistics.hpp"
+
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "storage/segment_iterate.hpp"
+
+namespace opossum {
+
+size_t BaseColumnStatistics::row_count() const { return _row_count; }
+
+size_t BaseColumnStatistics::distinct_count() const { return std::min(_distinct_values.estimate(), _row_count); }
+
+double BaseColumnStatistics::null_fraction() const { return 0.0; }
+
+template <typename T>
+ColumnStatistics<T>::ColumnStatistics(const size_t sample_size, const size_t bin_count)
+    : _sample_size{sample_size}, _bin_count{bin_count} {
+  Assert(sample_size > 0 && bin_count > 0, "Sample size and bin count must be greater than zero");
+}
+
+template <typename T>
+void ColumnStatistics<T>::add_segment(const BaseSegment& segment) {
+  if (segment.size() == 0) return;
+
+  const auto hash = std::hash<detail::IteratedValueType<T>>{};
+  segment_iterate<T>(segment, [&](const ChunkOffset, const auto& value) {
+    _distinct_values.insert(hash(value));
+
+    // Reservoir sampling: the n-th value replaces a random sample entry with probability sample_size / n
+    ++_row_count;
+    if (_sample.size() < _sample_size) {
+      _sample.emplace_back(value);
+      return;
+    }
+    const auto index = std::uniform_int_distribution<size_t>{0, _row_count - 1}(_random_engine);
+    if (index < _sample_size) _sample[index] = T(value);
+  });
+}
+
+template <typename T>
+void ColumnStatistics<T>::build_histogram() {
+  if (_row_count == 0) return;
+
+  auto sorted_sample = _sample;
+  std::sort(sorted_sample.begin(), sorted_sample.end());
+  _histogram = std::make_shared<EquiHeightHistogram<T>>(sorted_sample, _bin_count, _row_count, distinct_count());
+}
+
+template <typename T>
+std::shared_ptr<BaseColumnStatistics> ColumnStatistics<T>::copy() const {
+  auto statistics = std::make_shared<ColumnStatistics<T>>(_sample_size, _bin_count);
+  statistics->_row_count = _row_count;
+  statistics->_distinct_values = _distinct_values;
+  statistics->_sample = _sample;
+  statistics->_random_engine = _random_engine;
+  // histograms are immutable and can be shared
+  statistics->_histogram = _histogram;
+  return statistics;
+}
+
+template <typename T>
+double ColumnStatistics<T>::estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  return boost::apply_visitor(
+      [&](const auto& value) {
+        using SearchValueType = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<SearchValueType, T>) {
+          return estimate_selectivity(scan_type, value);
+        } else if constexpr (std::is_arithmetic_v<SearchValueType> && std::is_arithmetic_v<T>) {
+          // numeric_cast throws if the value is out of range, the comparison detects lost fractions and precision
+          try {
+            const auto converted_value = boost::numeric_cast<T>(value);
+            if (boost::numeric_cast<SearchValueType>(converted_value) == value) {
+              return estimate_selectivity(scan_type, converted_value);
+            }
+          } catch (const boost::numeric::bad_numeric_cast&) {
+          }
+          return 1.0;
+        } else {
+          return 1.0;
+        }
+      },
+      search_value);
+}
+
+template <typename T>
+double ColumnStatistics<T>::estimate_selectivity(const ScanType scan_type, const T& search_value) const {
+  if (!_histogram) return 1.0;
+  return std::clamp(_histogram->estimate_cardinality(scan_type, search_value) / _histogram->total_count(), 0.0, 1.0);
+}
+
+template <typename T>
+std::shared_ptr<const EquiHeightHistogram<T>> ColumnStatistics<T>::histogram() const {
+  return _histogram;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "equi_height_histogram.hpp"
+#include "hyper_log_log.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// Statistics of a single column, maintained segment by segment as chunks are completed (see TableStatistics)
+class BaseColumnStatistics : private Noncopyable {
+ public:
+  virtual ~BaseColumnStatistics() = default;
+
+  // adds the values of a segment of this column, e.g., when its chunk is complete. The estimates only include them
+  // once build_histogram() is called, so that adding many segments does not rebuild the histogram every time.
+  virtual void add_segment(const BaseSegment& segment) = 0;
+
+  // rebuilds the histogram from the values of all added segments
+  virtual void build_histogram() = 0;
+
+  // returns an independent copy of the statistics, e.g., to add segments without modifying statistics in use
+  virtual std::shared_ptr<BaseColumnStatistics> copy() const = 0;
+
+  // Estimates the share of rows (between 0 and 1) for which `value <scan_type> search_value` holds. Returns 1 if no
+  // rows have been added yet.
+  virtual double estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // returns the number of rows of all added segments
+  size_t row_count() const;
+
+  // returns an estimate of the number of distinct values among all added segments
+  size_t distinct_count() const;
+
+  // segments cannot hold NULL values yet, so this is always zero
+  double null_fraction() const;
+
+ protected:
+  size_t _row_count = 0;
+  HyperLogLog _distinct_values;
+};
+
+// Keeps a uniform sample of the column (reservoir sampling) from which an equi-height histogram is built. Distinct
+// values are counted with a HyperLogLog sketch. Both need constant memory, regardless of the number of rows.
+template <typename T>
+class ColumnStatistics : public BaseColumnStatistics {
+ public:
+  static constexpr size_t DEFAULT_SAMPLE_SIZE = 10'000;
+  static constexpr size_t DEFAULT_BIN_COUNT = 100;
+
+  explicit ColumnStatistics(const size_t sample_size = DEFAULT_SAMPLE_SIZE,
+                            const size_t bin_count = DEFAULT_BIN_COUNT);
+
+  void add_segment(const BaseSegment& segment) final;
+
+  void build_histogram() final;
+
+  std::shared_ptr<BaseColumnStatistics> copy() const final;
+
+  // Search values of other data types are converted if both types are numeric and the conversion does not change the
+  // value (e.g., 2.0 for an int column, but not 2.5, as `< 2.5` is not the same as `< 2`). Otherwise, 1 is returned.
+  double estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  // same as above, but without going through AllTypeVariant
+  double estimate_selectivity(const ScanType scan_type, const T& search_value) const;
+
+  // returns the histogram of all added segments, or nullptr if no rows have been added yet
+  std::shared_ptr<const EquiHeightHistogram<T>> histogram() const;
+
+ protected:
+  const size_t _sample_size;
+  const size_t _bin_count;
+
+  std::vector<T> _sample;
+  // fixed seed, so that statistics (and thus plans) are reproducible
+  std::mt19937_64 _random_engine{17};
+
+  std::shared_ptr<const EquiHeightHistogram<T>> _histogram;
+};
+
+}  // namespace opossum
@@ -0,0 +1,179 @@
+#include "equi_height_histogram.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Strings cannot be subtracted, so they are mapped to numbers first. The common prefix of the bin's minimum and
+// maximum is skipped (the value shares it, as it lies within the bin), and the next characters are read as digits of
+// a base-256 fraction.
+double string_share_below(const std::string& minimum, const std::string& maximum, const std::string& value) {
+  constexpr auto SIGNIFICANT_CHARACTERS = size_t{6};
+
+  auto prefix_length = size_t{0};
+  while (prefix_length < minimum.size() && prefix_length < maximum.size() &&
+         minimum[prefix_length] == maximum[prefix_length]) {
+    ++prefix_length;
+  }
+
+  const auto to_number = [&](const std::string& string) {
+    auto number = 0.0;
+    auto scale = 1.0;
+    for (auto index = prefix_length; index < prefix_length + SIGNIFICANT_CHARACTERS; ++index) {
+      scale /= 256.0;
+      if (index < string.size()) number += static_cast<unsigned char>(string[index]) * scale;
+    }
+    return number;
+  };
+
+  const auto range = to_number(maximum) - to_number(minimum);
+  if (range <= 0.0) return 0.5;
+  return std::clamp((to_number(value) - to_number(minimum)) / range, 0.0, 1.0);
+}
+
+}  // namespace
+
+template <typename T>
+EquiHeightHistogram<T>::EquiHeightHistogram(const std::vector<T>& sorted_values, const size_t max_bin_count,
+                                            const size_t row_count, const size_t distinct_count) {
+  DebugAssert(std::is_sorted(sorted_values.cbegin(), sorted_values.cend()), "Values must be sorted");
+  Assert(max_bin_count > 0, "A histogram needs at least one bin");
+  if (sorted_values.empty()) return;
+
+  const auto value_count = sorted_values.size();
+  const auto values_per_bin = (value_count + max_bin_count - 1) / max_bin_count;
+
+  auto sampled_distinct_counts = std::vector<size_t>{};
+  auto begin = size_t{0};
+  while (begin < value_count) {
+    auto end = std::min(begin + values_per_bin, value_count);
+    while (end < value_count && sorted_values[end] == sorted_values[end - 1]) ++end;
+
+    _bin_minima.push_back(sorted_values[begin]);
+    _bin_maxima.push_back(sorted_values[end - 1]);
+    _bin_heights.push_back(static_cast<double>(end - begin));
+
+    auto bin_distinct_count = size_t{1};
+    for (auto index = begin + 1; index < end; ++index) {
+      if (sorted_values[index] != sorted_values[index - 1]) ++bin_distinct_count;
+    }
+    sampled_distinct_counts.push_back(bin_distinct_count);
+
+    begin = end;
+  }
+
+  const auto height_scale = static_cast<double>(row_count) / static_cast<double>(value_count);
+  const auto sampled_distinct_count = std::accumulate(sampled_distinct_counts.cbegin(), sampled_distinct_counts.cend(),
+                                                      size_t{0});
+  // a sample cannot contain more distinct values than the column, but the column might contain many more
+  const auto distinct_scale = static_cast<double>(std::max(distinct_count, sampled_distinct_count)) /
+                              static_cast<double>(sampled_distinct_count);
+
+  for (auto bin_id = size_t{0}; bin_id < _bin_heights.size(); ++bin_id) {
+    _bin_heights[bin_id] *= height_scale;
+    _bin_distinct_counts.push_back(
+        std::clamp(sampled_distinct_counts[bin_id] * distinct_scale, 1.0, std::max(_bin_heights[bin_id], 1.0)));
+  }
+  _total_count = static_cast<double>(row_count);
+}
+
+template <typename T>
+size_t EquiHeightHistogram<T>::bin_count() const {
+  return _bin_heights.size();
+}
+
+template <typename T>
+const T& EquiHeightHistogram<T>::bin_minimum(const size_t bin_id) const {
+  return _bin_minima.at(bin_id);
+}
+
+template <typename T>
+const T& EquiHeightHistogram<T>::bin_maximum(const size_t bin_id) const {
+  return _bin_maxima.at(bin_id);
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::bin_height(const size_t bin_id) const {
+  return _bin_heights.at(bin_id);
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::bin_distinct_count(const size_t bin_id) const {
+  return _bin_distinct_counts.at(bin_id);
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::total_count() const {
+  return _total_count;
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::estimate_cardinality(const ScanType scan_type, const T& search_value) const {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _estimate_equals(search_value);
+    case ScanType::OpNotEquals:
+      return _total_count - _estimate_equals(search_value);
+    case ScanType::OpLessThan:
+      return _estimate_less_than(search_value);
+    case ScanType::OpLessThanEquals:
+      return std::min(_total_count, _estimate_less_than(search_value) + _estimate_equals(search_value));
+    case ScanType::OpGreaterThan:
+      return std::max(0.0, _total_count - _estimate_less_than(search_value) - _estimate_equals(search_value));
+    case ScanType::OpGreaterThanEquals:
+      return _total_count - _estimate_less_than(search_value);
+  }
+  Fail("Unknown scan type");
+  return 0.0;
+}
+
+template <typename T>
+size_t EquiHeightHistogram<T>::_bin_for_value(const T& value) const {
+  return std::distance(_bin_maxima.cbegin(), std::lower_bound(_bin_maxima.cbegin(), _bin_maxima.cend(), value));
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::_share_below(const size_t bin_id, const T& value) const {
+  const auto& minimum = _bin_minima[bin_id];
+  const auto& maximum = _bin_maxima[bin_id];
+  if (value <= minimum) return 0.0;
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    return string_share_below(minimum, maximum, value);
+  } else if constexpr (std::is_integral_v<T>) {
+    // discrete values: [minimum, value) out of [minimum, maximum]
+    return (static_cast<double>(value) - static_cast<double>(minimum)) /
+           (static_cast<double>(maximum) - static_cast<double>(minimum) + 1.0);
+  } else {
+    return (static_cast<double>(value) - static_cast<double>(minimum)) /
+           (static_cast<double>(maximum) - static_cast<double>(minimum));
+  }
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::_estimate_equals(const T& value) const {
+  const auto bin_id = _bin_for_value(value);
+  if (bin_id == bin_count() || value < _bin_minima[bin_id]) return 0.0;
+  return _bin_heights[bin_id] / _bin_distinct_counts[bin_id];
+}
+
+template <typename T>
+double EquiHeightHistogram<T>::_estimate_less_than(const T& value) const {
+  const auto bin_id = _bin_for_value(value);
+  auto cardinality = std::accumulate(_bin_heights.cbegin(), _bin_heights.cbegin() + bin_id, 0.0);
+  if (bin_id < bin_count()) cardinality += _bin_heights[bin_id] * _share_below(bin_id, value);
+  return cardinality;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(EquiHeightHistogram);
+
+}  // namespace opossum
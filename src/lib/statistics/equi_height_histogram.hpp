@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * An equi-height histogram splits the value range of a column into bins that hold about the same number of rows. For
+ * each bin, it stores the smallest and largest value, the number of rows (height), and the number of distinct
+ * values. Within a bin, values are assumed to be distributed uniformly.
+ *
+ * Histograms are usually built from a sample of the column (see ColumnStatistics). Heights and distinct counts are
+ * therefore floating point numbers that are scaled to the size of the column.
+ */
+template <typename T>
+class EquiHeightHistogram {
+ public:
+  // Creates a histogram with at most max_bin_count bins from sorted values. Equal values are never split across bins.
+  // The bin heights are scaled so that they sum up to row_count, the distinct counts so that they sum up to
+  // distinct_count.
+  EquiHeightHistogram(const std::vector<T>& sorted_values, const size_t max_bin_count, const size_t row_count,
+                      const size_t distinct_count);
+
+  size_t bin_count() const;
+
+  const T& bin_minimum(const size_t bin_id) const;
+  const T& bin_maximum(const size_t bin_id) const;
+  double bin_height(const size_t bin_id) const;
+  double bin_distinct_count(const size_t bin_id) const;
+
+  // returns the sum of all bin heights
+  double total_count() const;
+
+  // estimates the number of rows for which `value <scan_type> search_value` holds
+  double estimate_cardinality(const ScanType scan_type, const T& search_value) const;
+
+ protected:
+  // returns the id of the first bin whose maximum is not smaller than the value, or bin_count() if there is none
+  size_t _bin_for_value(const T& value) const;
+
+  // estimates the share of the bin's rows that are smaller than the value, which has to lie within the bin
+  double _share_below(const size_t bin_id, const T& value) const;
+
+  double _estimate_equals(const T& value) const;
+  double _estimate_less_than(const T& value) const;
+
+  std::vector<T> _bin_minima;
+  std::vector<T> _bin_maxima;
+  std::vector<double> _bin_heights;
+  std::vector<double> _bin_distinct_counts;
+  double _total_count = 0.0;
+};
+
+}  // namespace opossum
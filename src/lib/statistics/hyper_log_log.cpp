@@ -0,0 +1,54 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/hash_utils.hpp"
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog() : _registers(size_t{1} << PRECISION) {}
+
+void HyperLogLog::insert(const size_t hash) {
+  const auto mixed = mix_hash(hash);
+
+  // the first PRECISION bits select the register, which stores the maximum position of the first set bit in the
+  // remaining bits. The guard bit limits that position if all remaining bits are zero.
+  const auto register_index = mixed >> (64 - PRECISION);
+  const auto remaining_bits = (mixed << PRECISION) | (uint64_t{1} << (PRECISION - 1));
+  const auto rank = static_cast<uint8_t>(__builtin_clzll(remaining_bits) + 1);
+
+  _registers[register_index] = std::max(_registers[register_index], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  DebugAssert(_registers.size() == other._registers.size(), "Cannot merge sketches of different precision");
+  for (auto register_index = size_t{0}; register_index < _registers.size(); ++register_index) {
+    _registers[register_index] = std::max(_registers[register_index], other._registers[register_index]);
+  }
+}
+
+size_t HyperLogLog::estimate() const {
+  const auto register_count = static_cast<double>(_registers.size());
+
+  auto sum = 0.0;
+  auto empty_register_count = size_t{0};
+  for (const auto value : _registers) {
+    sum += std::ldexp(1.0, -value);
+    if (value == 0) ++empty_register_count;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  auto estimate = alpha * register_count * register_count / sum;
+
+  // for small cardinalities, linear counting on the empty registers is more accurate
+  if (estimate <= 2.5 * register_count && empty_register_count > 0) {
+    estimate = register_count * std::log(register_count / static_cast<double>(empty_register_count));
+  }
+
+  return static_cast<size_t>(std::llround(estimate));
+}
+
+}  // namespace opossum
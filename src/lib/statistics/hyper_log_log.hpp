@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+// HyperLogLog sketch (Flajolet et al.) that estimates the number of distinct values among all inserted hashes in
+// constant memory. Two sketches can be merged, so the distinct count of a column can be maintained chunk by chunk.
+// With PRECISION = 12, the sketch takes 4 KiB and the standard error is about 1.6%.
+class HyperLogLog {
+ public:
+  static constexpr uint8_t PRECISION = 12;
+
+  HyperLogLog();
+
+  void insert(const size_t hash);
+
+  // afterwards, the sketch estimates the distinct count of the union of both inputs
+  void merge(const HyperLogLog& other);
+
+  size_t estimate() const;
+
+ protected:
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
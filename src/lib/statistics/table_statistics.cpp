@@ -0,0 +1,58 @@
+#include "table_statistics.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void TableStatistics::add_column(const std::string& data_type) {
+  Assert(_chunk_count == ChunkID{0}, "Columns can only be added before chunks are added");
+  _column_statistics.push_back(make_shared_by_data_type<BaseColumnStatistics, ColumnStatistics>(data_type));
+}
+
+void TableStatistics::add_chunks(const std::vector<std::shared_ptr<const Chunk>>& chunks) {
+  if (chunks.empty()) return;
+
+  for (const auto& chunk : chunks) {
+    DebugAssert(chunk->column_count() == _column_statistics.size(), "Chunk does not match the statistics");
+
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      _column_statistics[column_id]->add_segment(*chunk->get_segment(column_id));
+    }
+    _row_count += chunk->size();
+    ++_chunk_count;
+  }
+
+  for (const auto& column_statistics : _column_statistics) column_statistics->build_histogram();
+}
+
+std::shared_ptr<TableStatistics> TableStatistics::copy() const {
+  auto statistics = std::make_shared<TableStatistics>();
+  statistics->_row_count = _row_count;
+  statistics->_chunk_count = _chunk_count;
+  statistics->_column_statistics.reserve(_column_statistics.size());
+  for (const auto& column_statistics : _column_statistics) {
+    statistics->_column_statistics.push_back(column_statistics->copy());
+  }
+  return statistics;
+}
+
+uint64_t TableStatistics::row_count() const { return _row_count; }
+
+ChunkID TableStatistics::chunk_count() const { return _chunk_count; }
+
+const BaseColumnStatistics& TableStatistics::column_statistics(const ColumnID column_id) const {
+  return *_column_statistics.at(column_id);
+}
+
+double TableStatistics::estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                                             const AllTypeVariant& search_value) const {
+  return column_statistics(column_id).estimate_selectivity(scan_type, search_value);
+}
+
+}  // namespace opossum
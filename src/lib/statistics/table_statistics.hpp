@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "column_statistics.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// Statistics of a table for cardinality estimation. Table builds them from its complete chunks when they are first
+// requested (see Table::table_statistics). Adding chunks is not thread-safe, so Table adds them to a copy.
+class TableStatistics : private Noncopyable {
+ public:
+  // adds the statistics of a column of the given data type. Can only be called before the first chunk is added.
+  void add_column(const std::string& data_type);
+
+  // adds the values of all segments of the chunks and rebuilds the histograms once
+  void add_chunks(const std::vector<std::shared_ptr<const Chunk>>& chunks);
+
+  // returns an independent copy of the statistics
+  std::shared_ptr<TableStatistics> copy() const;
+
+  // returns the number of rows of all added chunks
+  uint64_t row_count() const;
+
+  // returns the number of added chunks
+  ChunkID chunk_count() const;
+
+  const BaseColumnStatistics& column_statistics(const ColumnID column_id) const;
+
+  // estimates the share of rows (between 0 and 1) for which `column <scan_type> search_value` holds
+  double estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                              const AllTypeVariant& search_value) const;
+
+ protected:
+  uint64_t _row_count = 0;
+  ChunkID _chunk_count{0};
+  std::vector<std::shared_ptr<BaseColumnStatistics>> _column_statistics;
+};
+
+}  // namespace opossum
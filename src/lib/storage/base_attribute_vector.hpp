@@ -4,8 +4,12 @@
 
 namespace opossum {
 
+// Determines the attribute vector type used by a DictionarySegment. Fitted uses whole bytes per value id
+// (fastest random access), BitPacked uses just as many bits as needed (smallest footprint).
+enum class AttributeVectorEncoding { Fitted, BitPacked };
+
 // BaseAttributeVector is the abstract super class for all attribute vectors,
-// e.g., FittedAttributeVector
+// e.g., FittedAttributeVector, BitPackedAttributeVector
 class BaseAttributeVector : private Noncopyable {
  public:
   BaseAttributeVector() = default;
@@ -19,6 +23,10 @@ class BaseAttributeVector : private Noncopyable {
   // returns the value id at a given position
   virtual ValueID get(const size_t i) const = 0;
 
+  // Writes the value ids at positions [begin, begin + count) to output. Much faster than calling get() for each
+  // position, e.g., bit-packed vectors unpack whole blocks at once.
+  virtual void unpack(const size_t begin, const size_t count, ValueID* output) const = 0;
+
   // sets the value id at a given position
   virtual void set(const size_t i, const ValueID value_id) = 0;
 
@@ -27,5 +35,8 @@ class BaseAttributeVector : private Noncopyable {
 
   // returns the width of biggest value id in bytes
   virtual AttributeVectorWidth width() const = 0;
+
+  // returns the number of bytes the attribute vector occupies
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+
+// BaseDictionarySegment is the type-independent interface of DictionarySegment<T>. Code that only works on value
+// ids, e.g., indexes or scans on dictionary-encoded segments, can use it without resolving the data type.
+class BaseDictionarySegment : public BaseSegment {
+ public:
+  // returns the first value ID that refers to a value >= the search value
+  // returns INVALID_VALUE_ID if all values are smaller than the search value
+  virtual ValueID lower_bound(const AllTypeVariant& value) const = 0;
+
+  // returns the first value ID that refers to a value > the search value
+  // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
+  virtual ValueID upper_bound(const AllTypeVariant& value) const = 0;
+
+  // return the number of unique_values (dictionary entries)
+  virtual size_t unique_values_count() const = 0;
+
+  // returns the attribute vector that holds a ValueID for each row
+  virtual std::shared_ptr<const BaseAttributeVector> attribute_vector() const = 0;
+};
+}  // namespace opossum
@@ -0,0 +1,140 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr size_t LANE_COUNT = 4;
+constexpr size_t WORD_BITS = 32;
+
+}  // namespace
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t dictionary_size, const size_t size) : _size{size} {
+  Assert(dictionary_size <= size_t{std::numeric_limits<ValueID::base_type>::max()} + 1,
+         "Dictionary is too large for ValueIDs");
+
+  // the largest value id is dictionary_size - 1, we use at least one bit
+  _bit_width = 1;
+  while (_bit_width < WORD_BITS && (size_t{1} << _bit_width) < dictionary_size) ++_bit_width;
+  _mask = _bit_width == WORD_BITS ? std::numeric_limits<uint32_t>::max() : (uint32_t{1} << _bit_width) - 1;
+
+  _words.resize(block_count() * LANE_COUNT * _bit_width);
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const uint8_t bit_width, const size_t size,
+                                                   std::vector<uint32_t>&& words)
+    : _bit_width{bit_width}, _size{size}, _words{std::move(words)} {
+  Assert(bit_width >= 1 && bit_width <= WORD_BITS, "Invalid bit width");
+  _mask = _bit_width == WORD_BITS ? std::numeric_limits<uint32_t>::max() : (uint32_t{1} << _bit_width) - 1;
+  Assert(_words.size() == block_count() * LANE_COUNT * _bit_width, "Number of words does not match the size");
+}
+
+size_t BitPackedAttributeVector::_word_index(const size_t i) const {
+  const auto block_index = i / BLOCK_SIZE;
+  const auto lane = i % LANE_COUNT;
+  const auto position_in_lane = (i % BLOCK_SIZE) / LANE_COUNT;
+  const auto word_in_lane = position_in_lane * _bit_width / WORD_BITS;
+  return block_index * LANE_COUNT * _bit_width + word_in_lane * LANE_COUNT + lane;
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "Position out of range");
+
+  const auto word_index = _word_index(i);
+  const auto shift = ((i % BLOCK_SIZE) / LANE_COUNT) * _bit_width % WORD_BITS;
+
+  auto value = _words[word_index] >> shift;
+  if (shift + _bit_width > WORD_BITS) {
+    value |= _words[word_index + LANE_COUNT] << (WORD_BITS - shift);
+  }
+  return ValueID{value & _mask};
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  DebugAssert(i < _size, "Position out of range");
+  DebugAssert((value_id.t & ~_mask) == 0, "Value id does not fit into attribute vector");
+
+  const auto word_index = _word_index(i);
+  const auto shift = ((i % BLOCK_SIZE) / LANE_COUNT) * _bit_width % WORD_BITS;
+
+  _words[word_index] = (_words[word_index] & ~(_mask << shift)) | (value_id.t << shift);
+  if (shift + _bit_width > WORD_BITS) {
+    const auto high_shift = WORD_BITS - shift;
+    auto& next_word = _words[word_index + LANE_COUNT];
+    next_word = (next_word & ~(_mask >> high_shift)) | (value_id.t >> high_shift);
+  }
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const {
+  return static_cast<AttributeVectorWidth>((_bit_width + 7) / 8);
+}
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const {
+  return sizeof(*this) + vector_memory_usage(_words);
+}
+
+uint8_t BitPackedAttributeVector::bit_width() const { return _bit_width; }
+
+size_t BitPackedAttributeVector::block_count() const { return (_size + BLOCK_SIZE - 1) / BLOCK_SIZE; }
+
+const std::vector<uint32_t>& BitPackedAttributeVector::words() const { return _words; }
+
+void BitPackedAttributeVector::unpack(const size_t begin, const size_t count, ValueID* output) const {
+  DebugAssert(begin + count <= _size, "Positions out of range");
+
+  auto block = Block{};
+  const auto end = begin + count;
+  for (auto position = begin; position < end;) {
+    const auto block_index = position / BLOCK_SIZE;
+    const auto offset_in_block = position % BLOCK_SIZE;
+    const auto unpack_count = std::min(BLOCK_SIZE - offset_in_block, end - position);
+
+    // whole blocks are decoded in place, partial ones (at the begin and end of the range) through a buffer
+    if (unpack_count == BLOCK_SIZE) {
+      _decode_block(block_index, output);
+    } else {
+      _decode_block(block_index, block.data());
+      std::copy_n(block.cbegin() + offset_in_block, unpack_count, output);
+    }
+    output += unpack_count;
+    position += unpack_count;
+  }
+}
+
+void BitPackedAttributeVector::decode_block(const size_t block_index, Block& output) const {
+  _decode_block(block_index, output.data());
+}
+
+void BitPackedAttributeVector::_decode_block(const size_t block_index, ValueID* output) const {
+  DebugAssert(block_index < block_count(), "Block index out of range");
+
+  const auto* const words = _words.data() + block_index * LANE_COUNT * _bit_width;
+  const auto bit_width = _bit_width;
+  const auto mask = _mask;
+
+  // The inner loop processes the same position of all four lanes, which read four consecutive words.
+  for (auto position_in_lane = size_t{0}; position_in_lane < BLOCK_SIZE / LANE_COUNT; ++position_in_lane) {
+    const auto bit_offset = position_in_lane * bit_width;
+    const auto* const low_words = words + (bit_offset / WORD_BITS) * LANE_COUNT;
+    const auto shift = bit_offset % WORD_BITS;
+    const auto spans_words = shift + bit_width > WORD_BITS;
+
+    for (auto lane = size_t{0}; lane < LANE_COUNT; ++lane) {
+      auto value = low_words[lane] >> shift;
+      if (spans_words) value |= low_words[LANE_COUNT + lane] << (WORD_BITS - shift);
+      output[position_in_lane * LANE_COUNT + lane] = ValueID{value & mask};
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BitPackedAttributeVector stores value ids with an arbitrary bit width (1 to 32 bits) instead of whole bytes.
+//
+// The layout follows SIMD-BP128: values are grouped into blocks of 128. Within a block, value i belongs to lane i % 4
+// and each lane is packed into its own stream of 32-bit words. The words of the four lanes are interleaved, so that
+// unpacking one position of all four lanes touches four consecutive words. This allows the compiler to vectorize
+// decode_block(). A block occupies exactly 4 * bit_width words.
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  static constexpr size_t BLOCK_SIZE = 128;
+  using Block = std::array<ValueID, BLOCK_SIZE>;
+
+  // creates an attribute vector with `size` entries, all initialized to zero, that is just wide enough to hold
+  // all value ids of a dictionary with `dictionary_size` entries
+  BitPackedAttributeVector(const size_t dictionary_size, const size_t size);
+
+  // creates an attribute vector from already packed words, e.g., as returned by words()
+  BitPackedAttributeVector(const uint8_t bit_width, const size_t size, std::vector<uint32_t>&& words);
+
+  ValueID get(const size_t i) const final;
+
+  // unpacks whole blocks directly into the output, see decode_block()
+  void unpack(const size_t begin, const size_t count, ValueID* output) const final;
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  // returns the number of bytes needed to store the bit width, rounded up
+  AttributeVectorWidth width() const final;
+
+  size_t estimate_memory_usage() const final;
+
+  // returns the number of bits used per value id
+  uint8_t bit_width() const;
+
+  // returns the number of blocks, the last block may be only partially used
+  size_t block_count() const;
+
+  // returns the packed words in the layout described above
+  const std::vector<uint32_t>& words() const;
+
+  // unpacks all value ids of the given block into the output buffer
+  // positions beyond size() in the last block are decoded as zero
+  void decode_block(const size_t block_index, Block& output) const;
+
+ protected:
+  // returns the index of the first word of the given lane in _words for a value at position i
+  size_t _word_index(const size_t i) const;
+
+  // unpacks all BLOCK_SIZE value ids of the given block to output
+  void _decode_block(const size_t block_index, ValueID* output) const;
+
+  uint8_t _bit_width;
+  uint32_t _mask;
+  size_t _size;
+  std::vector<uint32_t> _words;
+};
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/hash_utils.hpp"
+
+namespace opossum {
+
+BloomFilter::BloomFilter(const size_t value_count) {
+  // the number of bits is a power of two, so that probes can be mapped to bits with a mask
+  auto bit_count = uint64_t{64};
+  while (bit_count < value_count * BITS_PER_VALUE) bit_count *= 2;
+
+  _words.resize(bit_count / 64);
+  _bit_mask = bit_count - 1;
+}
+
+BloomFilter::BloomFilter(std::vector<uint64_t> words) : _words{std::move(words)} {
+  Assert(!_words.empty() && (_words.size() & (_words.size() - 1)) == 0, "Number of words must be a power of two");
+  _bit_mask = _words.size() * 64 - 1;
+}
+
+template <typename Functor>
+void BloomFilter::_for_each_bit(const size_t hash, const Functor& functor) const {
+  const auto mixed = mix_hash(hash);
+  const auto first_hash = mixed & 0xFFFFFFFFULL;
+  // odd, so that the probes differ for every bit count
+  const auto second_hash = (mixed >> 32) | 1;
+  for (auto probe = uint64_t{0}; probe < HASH_COUNT; ++probe) {
+    functor((first_hash + probe * second_hash) & _bit_mask);
+  }
+}
+
+void BloomFilter::insert(const size_t hash) {
+  _for_each_bit(hash, [&](const uint64_t bit) { _words[bit / 64] |= uint64_t{1} << (bit % 64); });
+}
+
+bool BloomFilter::may_contain(const size_t hash) const {
+  auto contained = true;
+  _for_each_bit(hash, [&](const uint64_t bit) { contained &= (_words[bit / 64] >> (bit % 64)) & 1; });
+  return contained;
+}
+
+size_t BloomFilter::estimate_memory_usage() const { return sizeof(*this) + _words.capacity() * sizeof(uint64_t); }
+
+const std::vector<uint64_t>& BloomFilter::words() const { return _words; }
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+// A Bloom filter over 64-bit hash values, used by SegmentStatistics to answer "may the segment contain value X?".
+// It never reports false negatives. With BITS_PER_VALUE bits per inserted value and HASH_COUNT probes, about 1% of
+// the lookups of values that were not inserted return a false positive. Not thread-safe while values are inserted.
+class BloomFilter {
+ public:
+  static constexpr size_t BITS_PER_VALUE = 10;
+  static constexpr size_t HASH_COUNT = 7;
+
+  // creates an empty filter sized for the given number of distinct values
+  explicit BloomFilter(const size_t value_count);
+
+  // restores a filter from its words (e.g., from a binary table), whose number must be a power of two
+  explicit BloomFilter(std::vector<uint64_t> words);
+
+  void insert(const size_t hash);
+
+  bool may_contain(const size_t hash) const;
+
+  // returns the number of bytes occupied by the filter
+  size_t estimate_memory_usage() const;
+
+  const std::vector<uint64_t>& words() const;
+
+ protected:
+  // The caller's hash (e.g., std::hash<int32_t>, which is the identity) is mixed, and the probes are derived from two
+  // halves of the result (double hashing)
+  template <typename Functor>
+  void _for_each_bit(const size_t hash, const Functor& functor) const;
+
+  std::vector<uint64_t> _words;
+  uint64_t _bit_mask;
+};
+
+}  // namespace opossum
@@ -1,40 +1,133 @@
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "index/base_index.hpp"
+#include "segment_statistics.hpp"
+#include "value_segment.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
 void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
-  // Implementation goes here
+  _segments.push_back(segment);
+  _segment_statistics.push_back(nullptr);
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
-  // Implementation goes here
+  DebugAssert(values.size() == _segments.size(), "Number of values does not match the number of segments");
+
+  for (auto column_id = ColumnID{0}; column_id < _segments.size(); ++column_id) {
+    get_segment(column_id)->append(values[column_id]);
+  }
+}
+
+void Chunk::append_columns(std::vector<ColumnValues>& columns, const size_t begin, const size_t end) {
+  DebugAssert(columns.size() == _segments.size(), "Number of columns does not match the number of segments");
+
+  for (auto column_id = ColumnID{0}; column_id < _segments.size(); ++column_id) {
+    boost::apply_visitor(
+        [&](auto& values) {
+          using ColumnDataType = typename std::decay_t<decltype(values)>::value_type;
+          const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(get_segment(column_id));
+          Assert(value_segment, "Column values do not match the type of the segment");
+          DebugAssert(end <= values.size(), "Column has fewer values than requested");
+
+          if (begin == 0 && end == values.size()) {
+            value_segment->append_values(std::move(values));
+          } else {
+            value_segment->append_values(std::make_move_iterator(values.begin() + begin),
+                                         std::make_move_iterator(values.begin() + end));
+          }
+        },
+        columns[column_id]);
+  }
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
-  // Implementation goes here
-  return nullptr;
+  return std::atomic_load(&_segments.at(column_id));
+}
+
+void Chunk::replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment) {
+  DebugAssert(segment->size() == size(), "Replacing segment must have the same size");
+  std::atomic_store(&_segments.at(column_id), segment);
+}
+
+std::shared_ptr<const BaseSegmentStatistics> Chunk::get_segment_statistics(ColumnID column_id) const {
+  return std::atomic_load(&_segment_statistics.at(column_id));
+}
+
+void Chunk::set_segment_statistics(ColumnID column_id, std::shared_ptr<const BaseSegmentStatistics> statistics) {
+  std::atomic_store(&_segment_statistics.at(column_id), statistics);
+}
+
+bool Chunk::can_prune(ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value) const {
+  const auto statistics = get_segment_statistics(column_id);
+  return statistics && statistics->can_prune(scan_type, search_value);
+}
+
+bool Chunk::may_contain(ColumnID column_id, const AllTypeVariant& value) const {
+  const auto statistics = get_segment_statistics(column_id);
+  return !statistics || statistics->may_contain(value);
+}
+
+void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
+  const auto iter = std::find(_indexes.cbegin(), _indexes.cend(), index);
+  DebugAssert(iter != _indexes.cend(), "Trying to remove an index that does not belong to this chunk");
+  _indexes.erase(iter);
+}
+
+std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indexes(
+    const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  auto indexes = std::vector<std::shared_ptr<BaseIndex>>{};
+  std::copy_if(_indexes.cbegin(), _indexes.cend(), std::back_inserter(indexes),
+               [&](const auto& index) { return index->is_index_for(segments); });
+  return indexes;
+}
+
+std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indexes(const std::vector<ColumnID>& column_ids) const {
+  return get_indexes(_get_segments_for_ids(column_ids));
 }
 
-uint16_t Chunk::column_count() const {
-  // Implementation goes here
-  return 0;
+std::vector<std::shared_ptr<const BaseSegment>> Chunk::_get_segments_for_ids(
+    const std::vector<ColumnID>& column_ids) const {
+  auto segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+  segments.reserve(column_ids.size());
+  for (const auto& column_id : column_ids) {
+    segments.emplace_back(get_segment(column_id));
+  }
+  return segments;
 }
 
+size_t Chunk::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _segments.capacity() * sizeof(std::shared_ptr<BaseSegment>) +
+               _segment_statistics.capacity() * sizeof(std::shared_ptr<const BaseSegmentStatistics>);
+  for (auto column_id = ColumnID{0}; column_id < _segments.size(); ++column_id) {
+    bytes += get_segment(column_id)->estimate_memory_usage();
+    if (const auto statistics = get_segment_statistics(column_id)) bytes += statistics->estimate_memory_usage();
+  }
+  for (const auto& index : _indexes) {
+    bytes += index->estimate_memory_usage();
+  }
+  return bytes;
+}
+
+uint16_t Chunk::column_count() const { return static_cast<uint16_t>(_segments.size()); }
+
 uint32_t Chunk::size() const {
-  // Implementation goes here
-  return 0;
+  if (_segments.empty()) return 0;
+  // the segment may be replaced by a background encoding at the same time
+  return static_cast<uint32_t>(get_segment(ColumnID{0})->size());
 }
 
 }  // namespace opossum
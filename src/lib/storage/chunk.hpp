@@ -15,6 +15,7 @@ namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+class BaseSegmentStatistics;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
@@ -42,11 +43,61 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Appends the rows [begin, end) of the given columns, one typed vector per segment. The values are moved out of the
+  // vectors. If a segment is empty and a column is appended as a whole, the vector is taken over without copying.
+  // Requires all segments to be ValueSegments of the respective type. Not thread-safe.
+  void append_columns(std::vector<ColumnValues>& columns, const size_t begin, const size_t end);
+
+  // returns the number of bytes occupied by the chunk and all its segments, segment statistics, and indexes
+  size_t estimate_memory_usage() const;
+
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Atomically replaces the segment at a given position, e.g., with an encoded version of the same values.
+  // Concurrent calls to get_segment() return either the old or the new segment.
+  void replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment);
+
+  // Returns the statistics of the segment at a given position, or nullptr if they have not been computed yet (they
+  // are set when the chunk is finalized, see Table)
+  std::shared_ptr<const BaseSegmentStatistics> get_segment_statistics(ColumnID column_id) const;
+
+  // Atomically sets the statistics of the segment at a given position. They remain valid if the segment is replaced
+  // by another segment holding the same values.
+  void set_segment_statistics(ColumnID column_id, std::shared_ptr<const BaseSegmentStatistics> statistics);
+
+  // Returns true if the segment statistics show that no row of this chunk satisfies
+  // `column <scan_type> search_value`. Returns false if there are no statistics for the column.
+  bool can_prune(ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value) const;
+
+  // Returns false if the segment statistics show that the column does not contain the value in this chunk, e.g., to
+  // skip chunks in point lookups or joins. Returns true if there are no statistics for the column.
+  bool may_contain(ColumnID column_id, const AllTypeVariant& value) const;
+
+  // Creates an index of the given type (e.g., GroupKeyIndex) on the current segments of the given columns. The index
+  // keeps indexing these segments, even if they are replaced in the chunk later on.
+  template <typename IndexType>
+  std::shared_ptr<BaseIndex> create_index(const std::vector<ColumnID>& column_ids) {
+    auto index = std::make_shared<IndexType>(_get_segments_for_ids(column_ids));
+    _indexes.emplace_back(index);
+    return index;
+  }
+
+  void remove_index(const std::shared_ptr<BaseIndex>& index);
+
+  // returns all indexes that cover exactly the given segments, in this order
+  std::vector<std::shared_ptr<BaseIndex>> get_indexes(
+      const std::vector<std::shared_ptr<const BaseSegment>>& segments) const;
+
+  // returns all indexes that cover exactly the current segments of the given columns, in this order
+  std::vector<std::shared_ptr<BaseIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
+
  protected:
-  // Implementation goes here
+  std::vector<std::shared_ptr<BaseSegment>> _segments;
+  std::vector<std::shared_ptr<const BaseSegmentStatistics>> _segment_statistics;
+  std::vector<std::shared_ptr<BaseIndex>> _indexes;
+
+  std::vector<std::shared_ptr<const BaseSegment>> _get_segments_for_ids(const std::vector<ColumnID>& column_ids) const;
 };
 
 }  // namespace opossum
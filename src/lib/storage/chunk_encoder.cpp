@@ -0,0 +1,194 @@
+#include "chunk_encoder.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "chunk.hpp"
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "segment_iterate.hpp"
+#include "segment_statistics.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+std::shared_ptr<BaseSegment> ChunkEncoder::encode_segment(const std::shared_ptr<BaseSegment>& segment,
+                                                          const std::string& data_type,
+                                                          const EncodingType encoding_type) {
+  if (get_encoding_type(segment, data_type) == encoding_type) return segment;
+
+  std::shared_ptr<BaseSegment> encoded_segment;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // Segments that were already encoded, e.g., by the background encoding, are decoded first
+    auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment);
+    if (!value_segment) {
+      auto values = std::vector<detail::IteratedValueType<ColumnDataType>>{};
+      values.reserve(segment->size());
+      segment_iterate<ColumnDataType>(*segment, [&](const ChunkOffset, const auto& value) { values.push_back(value); });
+      value_segment = std::make_shared<ValueSegment<ColumnDataType>>();
+      value_segment->append_values(values.cbegin(), values.cend());
+    }
+
+    switch (encoding_type) {
+      case EncodingType::Unencoded:
+        encoded_segment = value_segment;
+        return;
+      case EncodingType::Dictionary:
+        encoded_segment = std::make_shared<DictionarySegment<ColumnDataType>>(value_segment);
+        return;
+      case EncodingType::RunLength:
+        encoded_segment = std::make_shared<RunLengthSegment<ColumnDataType>>(value_segment);
+        return;
+      case EncodingType::FrameOfReference:
+        if constexpr (std::is_integral_v<ColumnDataType>) {
+          encoded_segment = std::make_shared<FrameOfReferenceSegment<ColumnDataType>>(value_segment);
+        } else {
+          Fail("FrameOfReference encoding is only supported for int and long segments");
+        }
+        return;
+    }
+  });
+
+  Assert(encoded_segment, "Unknown data type " + data_type);
+  return encoded_segment;
+}
+
+EncodingType ChunkEncoder::choose_encoding(const std::shared_ptr<BaseSegment>& segment, const std::string& data_type) {
+  auto encoding_type = EncodingType::Dictionary;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment);
+    Assert(value_segment, "Only ValueSegments can be encoded");
+
+    const auto segment_size = value_segment->size();
+    if (segment_size == 0) return;
+
+    auto run_count = size_t{1};
+    for (auto chunk_offset = size_t{1}; chunk_offset < segment_size; ++chunk_offset) {
+      if (value_segment->get(chunk_offset) != value_segment->get(chunk_offset - 1)) ++run_count;
+    }
+    if (run_count * MIN_AVERAGE_RUN_LENGTH <= segment_size) {
+      encoding_type = EncodingType::RunLength;
+      return;
+    }
+
+    if constexpr (std::is_integral_v<ColumnDataType>) {
+      using UnsignedType = std::make_unsigned_t<ColumnDataType>;
+      const auto& values = value_segment->values();
+      const auto block_size = FrameOfReferenceSegment<ColumnDataType>::BLOCK_SIZE;
+
+      // Estimate the size of a FrameOfReferenceSegment: one minimum per block plus the bit-packed offsets, whose width
+      // depends on the value range of the block. The offsets of a block are padded to whole blocks of the
+      // BitPackedAttributeVector.
+      auto frame_of_reference_bytes = size_t{0};
+      for (auto block_begin = size_t{0}; block_begin < segment_size; block_begin += block_size) {
+        const auto block_rows = std::min(block_size, segment_size - block_begin);
+        const auto block_values = values.cbegin() + block_begin;
+        const auto minmax = std::minmax_element(block_values, block_values + block_rows);
+        const auto range = uint64_t{static_cast<UnsignedType>(static_cast<UnsignedType>(*minmax.second) -
+                                                              static_cast<UnsignedType>(*minmax.first))};
+        if (range > std::numeric_limits<ValueID::base_type>::max()) return;
+
+        auto bit_width = size_t{1};
+        while ((uint64_t{1} << bit_width) <= range) ++bit_width;
+        const auto packed_rows = (block_rows + BitPackedAttributeVector::BLOCK_SIZE - 1) /
+                                 BitPackedAttributeVector::BLOCK_SIZE * BitPackedAttributeVector::BLOCK_SIZE;
+        frame_of_reference_bytes += sizeof(ColumnDataType) + packed_rows * bit_width / 8;
+      }
+
+      // Estimate the size of a DictionarySegment with a fitted attribute vector
+      auto distinct_values = std::vector<ColumnDataType>(values.cbegin(), values.cend());
+      std::sort(distinct_values.begin(), distinct_values.end());
+      const auto distinct_count = static_cast<size_t>(
+          std::distance(distinct_values.begin(), std::unique(distinct_values.begin(), distinct_values.end())));
+      const auto value_id_bytes = distinct_count <= (size_t{1} << 8) ? 1 : distinct_count <= (size_t{1} << 16) ? 2 : 4;
+      const auto dictionary_bytes = distinct_count * sizeof(ColumnDataType) + segment_size * value_id_bytes;
+
+      if (frame_of_reference_bytes < dictionary_bytes) encoding_type = EncodingType::FrameOfReference;
+    }
+  });
+
+  return encoding_type;
+}
+
+EncodingType ChunkEncoder::get_encoding_type(const std::shared_ptr<BaseSegment>& segment,
+                                             const std::string& data_type) {
+  auto encoding_type = std::optional<EncodingType>{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    if (std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment)) {
+      encoding_type = EncodingType::Unencoded;
+    } else if (std::dynamic_pointer_cast<DictionarySegment<ColumnDataType>>(segment)) {
+      encoding_type = EncodingType::Dictionary;
+    } else if (std::dynamic_pointer_cast<RunLengthSegment<ColumnDataType>>(segment)) {
+      encoding_type = EncodingType::RunLength;
+    }
+
+    if constexpr (std::is_integral_v<ColumnDataType>) {
+      if (std::dynamic_pointer_cast<FrameOfReferenceSegment<ColumnDataType>>(segment)) {
+        encoding_type = EncodingType::FrameOfReference;
+      }
+    }
+  });
+
+  Assert(encoding_type, "Unknown segment type or data type " + data_type);
+  return *encoding_type;
+}
+
+std::optional<std::string> ChunkEncoder::get_data_type(const BaseSegment& segment) {
+  auto data_type = std::optional<std::string>{};
+  hana::for_each(data_types, [&](auto type_pair) {
+    using ColumnDataType = typename decltype(+hana::second(type_pair))::type;
+    auto is_of_type = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment) ||
+                      dynamic_cast<const DictionarySegment<ColumnDataType>*>(&segment) ||
+                      dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&segment);
+    if constexpr (std::is_integral_v<ColumnDataType>) {
+      is_of_type |= dynamic_cast<const FrameOfReferenceSegment<ColumnDataType>*>(&segment) != nullptr;
+    }
+    if (is_of_type) data_type = hana::first(type_pair);
+  });
+  return data_type;
+}
+
+void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<std::string>& data_types) {
+  DebugAssert(data_types.size() == chunk->column_count(), "Number of data types does not match the number of segments");
+
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto segment = chunk->get_segment(column_id);
+    const auto encoding_type = choose_encoding(segment, data_types[column_id]);
+    const auto encoded_segment = encode_segment(segment, data_types[column_id], encoding_type);
+    chunk->replace_segment(column_id, encoded_segment);
+    chunk->set_segment_statistics(column_id, create_segment_statistics(*encoded_segment, data_types[column_id]));
+  }
+}
+
+void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<std::string>& data_types,
+                                const EncodingType encoding_type) {
+  DebugAssert(data_types.size() == chunk->column_count(), "Number of data types does not match the number of segments");
+
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto segment = chunk->get_segment(column_id);
+    const auto encoded_segment = encode_segment(segment, data_types[column_id], encoding_type);
+    chunk->replace_segment(column_id, encoded_segment);
+    chunk->set_segment_statistics(column_id, create_segment_statistics(*encoded_segment, data_types[column_id]));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+
+// The ChunkEncoder replaces the ValueSegments of a chunk that is no longer written to with encoded segments
+// (DictionarySegment, RunLengthSegment, FrameOfReferenceSegment). The segments are swapped atomically, so concurrent
+// readers either see the old or the new segment. Both contain the same values.
+class ChunkEncoder {
+ public:
+  // Encodes a segment of the given data type using the given encoding. Segments that are encoded differently are
+  // decoded first, segments that already use the given encoding are returned as they are.
+  static std::shared_ptr<BaseSegment> encode_segment(const std::shared_ptr<BaseSegment>& segment,
+                                                     const std::string& data_type, const EncodingType encoding_type);
+
+  // Picks an encoding for a ValueSegment: RunLength if the average run has at least MIN_AVERAGE_RUN_LENGTH values,
+  // FrameOfReference for int and long segments whose block ranges fit into 32 bits and whose estimated size is
+  // smaller than that of a DictionarySegment, and Dictionary otherwise.
+  static EncodingType choose_encoding(const std::shared_ptr<BaseSegment>& segment, const std::string& data_type);
+
+  // returns the encoding of a segment of the given data type
+  static EncodingType get_encoding_type(const std::shared_ptr<BaseSegment>& segment, const std::string& data_type);
+
+  // returns the data type of a segment as used in Table::column_type, or std::nullopt for other segment types (e.g.,
+  // ReferenceSegments)
+  static std::optional<std::string> get_data_type(const BaseSegment& segment);
+
+  // Encodes all segments of the chunk, using choose_encoding() to pick an encoding for each segment. As the chunk is
+  // final afterwards, the segment statistics used for pruning are computed as well.
+  static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<std::string>& data_types);
+
+  // encodes all segments of the chunk using the same encoding and computes their statistics
+  static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<std::string>& data_types,
+                           const EncodingType encoding_type);
+
+  static constexpr size_t MIN_AVERAGE_RUN_LENGTH = 4;
+};
+
+}  // namespace opossum
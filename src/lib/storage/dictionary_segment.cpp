@@ -0,0 +1,141 @@
+#include "dictionary_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "utils/size_estimation_utils.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+DictionarySegment<T>::DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment,
+                                        const AttributeVectorEncoding attribute_vector_encoding) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  Assert(value_segment, "DictionarySegment can only be created from a ValueSegment of the same type");
+
+  const auto segment_size = value_segment->size();
+
+  // For strings, get() returns a std::string_view into the segment's character buffer. Sorting these views instead of
+  // copies avoids materializing every string before the duplicates are removed.
+  using ValueType = std::decay_t<decltype(value_segment->get(0))>;
+  auto distinct_values = std::vector<ValueType>(segment_size);
+  for (auto chunk_offset = size_t{0}; chunk_offset < segment_size; ++chunk_offset) {
+    distinct_values[chunk_offset] = value_segment->get(chunk_offset);
+  }
+  std::sort(distinct_values.begin(), distinct_values.end());
+  distinct_values.erase(std::unique(distinct_values.begin(), distinct_values.end()), distinct_values.end());
+
+  _dictionary = std::make_shared<std::vector<T>>(distinct_values.cbegin(), distinct_values.cend());
+
+  switch (attribute_vector_encoding) {
+    case AttributeVectorEncoding::Fitted:
+      _attribute_vector = make_fitted_attribute_vector(_dictionary->size(), segment_size);
+      break;
+    case AttributeVectorEncoding::BitPacked:
+      _attribute_vector = std::make_shared<BitPackedAttributeVector>(_dictionary->size(), segment_size);
+      break;
+  }
+
+  for (auto chunk_offset = size_t{0}; chunk_offset < segment_size; ++chunk_offset) {
+    const auto& value = value_segment->get(chunk_offset);
+    const auto iter = std::lower_bound(distinct_values.cbegin(), distinct_values.cend(), value);
+    _attribute_vector->set(chunk_offset, ValueID{static_cast<ValueID::base_type>(iter - distinct_values.cbegin())});
+  }
+}
+
+template <typename T>
+DictionarySegment<T>::DictionarySegment(const std::shared_ptr<std::vector<T>>& dictionary,
+                                        const std::shared_ptr<BaseAttributeVector>& attribute_vector)
+    : _dictionary{dictionary}, _attribute_vector{attribute_vector} {
+  DebugAssert(std::is_sorted(_dictionary->cbegin(), _dictionary->cend()), "Dictionary must be sorted");
+}
+
+template <typename T>
+AllTypeVariant DictionarySegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  return get(chunk_offset);
+}
+
+template <typename T>
+T DictionarySegment<T>::get(const size_t chunk_offset) const {
+  return (*_dictionary)[_attribute_vector->get(chunk_offset)];
+}
+
+template <typename T>
+void DictionarySegment<T>::append(const AllTypeVariant&) {
+  Fail("DictionarySegment is immutable");
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> DictionarySegment<T>::dictionary() const {
+  return _dictionary;
+}
+
+template <typename T>
+std::shared_ptr<const BaseAttributeVector> DictionarySegment<T>::attribute_vector() const {
+  return _attribute_vector;
+}
+
+template <typename T>
+const T& DictionarySegment<T>::value_by_value_id(ValueID value_id) const {
+  return _dictionary->at(value_id);
+}
+
+template <typename T>
+ValueID DictionarySegment<T>::lower_bound(const T& value) const {
+  const auto iter = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+  if (iter == _dictionary->cend()) return INVALID_VALUE_ID;
+  return ValueID{static_cast<ValueID::base_type>(iter - _dictionary->cbegin())};
+}
+
+template <typename T>
+ValueID DictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
+  const auto cast_value = ceil_cast<T>(value);
+  if (!cast_value) return INVALID_VALUE_ID;
+  return lower_bound(cast_value->first);
+}
+
+template <typename T>
+ValueID DictionarySegment<T>::upper_bound(const T& value) const {
+  const auto iter = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+  if (iter == _dictionary->cend()) return INVALID_VALUE_ID;
+  return ValueID{static_cast<ValueID::base_type>(iter - _dictionary->cbegin())};
+}
+
+template <typename T>
+ValueID DictionarySegment<T>::upper_bound(const AllTypeVariant& value) const {
+  // if the value lies between two values of T (e.g., 3.5 for integers), no value equals it
+  const auto cast_value = ceil_cast<T>(value);
+  if (!cast_value) return INVALID_VALUE_ID;
+  return cast_value->second ? upper_bound(cast_value->first) : lower_bound(cast_value->first);
+}
+
+template <typename T>
+size_t DictionarySegment<T>::unique_values_count() const {
+  return _dictionary->size();
+}
+
+template <typename T>
+size_t DictionarySegment<T>::size() const {
+  return _attribute_vector->size();
+}
+
+template <typename T>
+size_t DictionarySegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + sizeof(*_dictionary) + vector_memory_usage(*_dictionary) +
+         _attribute_vector->estimate_memory_usage();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(DictionarySegment);
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_attribute_vector.hpp"
+#include "base_dictionary_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// DictionarySegment is a segment type that stores each distinct value once in a sorted dictionary. Each row only
+// references its value by a ValueID, i.e., the position of the value in the dictionary. The ValueIDs are kept in
+// an attribute vector that is just wide enough (in bytes or bits) to hold the largest ValueID.
+template <typename T>
+class DictionarySegment : public BaseDictionarySegment {
+ public:
+  // creates a dictionary segment from a given value segment
+  // the attribute vector encoding trades random access speed (Fitted) for memory footprint (BitPacked)
+  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment,
+                             const AttributeVectorEncoding attribute_vector_encoding = AttributeVectorEncoding::Fitted);
+
+  // creates a dictionary segment from an existing (sorted, distinct) dictionary and attribute vector
+  DictionarySegment(const std::shared_ptr<std::vector<T>>& dictionary,
+                    const std::shared_ptr<BaseAttributeVector>& attribute_vector);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // return the value at a certain position.
+  T get(const size_t chunk_offset) const;
+
+  // dictionary segments are immutable, appending fails
+  void append(const AllTypeVariant&) override;
+
+  // returns the sorted dictionary of distinct values
+  std::shared_ptr<const std::vector<T>> dictionary() const;
+
+  // returns the attribute vector that holds a ValueID for each row
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const override;
+
+  // return the value represented by a given ValueID
+  const T& value_by_value_id(ValueID value_id) const;
+
+  // returns the first value ID that refers to a value >= the search value
+  // returns INVALID_VALUE_ID if all values are smaller than the search value
+  ValueID lower_bound(const T& value) const;
+
+  // same as lower_bound(T), but accepts an AllTypeVariant, which is not rounded down (see ceil_cast)
+  ValueID lower_bound(const AllTypeVariant& value) const override;
+
+  // returns the first value ID that refers to a value > the search value
+  // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
+  ValueID upper_bound(const T& value) const;
+
+  // same as upper_bound(T), but accepts an AllTypeVariant, which is not rounded down (see ceil_cast)
+  ValueID upper_bound(const AllTypeVariant& value) const override;
+
+  // return the number of unique_values (dictionary entries)
+  size_t unique_values_count() const override;
+
+  // return the number of entries
+  size_t size() const override;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _dictionary;
+  std::shared_ptr<BaseAttributeVector> _attribute_vector;
+};
+
+}  // namespace opossum
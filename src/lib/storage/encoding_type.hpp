@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Identifies the segment type that a ValueSegment is encoded into, see ChunkEncoder
+enum class EncodingType { Unencoded, Dictionary, RunLength, FrameOfReference };
+
+inline std::string encoding_type_to_string(const EncodingType encoding_type) {
+  switch (encoding_type) {
+    case EncodingType::Unencoded:
+      return "Unencoded";
+    case EncodingType::Dictionary:
+      return "Dictionary";
+    case EncodingType::RunLength:
+      return "RunLength";
+    case EncodingType::FrameOfReference:
+      return "FrameOfReference";
+  }
+  Fail("Unknown encoding type");
+  return "";
+}
+
+}  // namespace opossum
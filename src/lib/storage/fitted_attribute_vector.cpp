@@ -0,0 +1,75 @@
+#include "fitted_attribute_vector.hpp"
+
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+template <typename uintX_t>
+FittedAttributeVector<uintX_t>::FittedAttributeVector(const size_t size) : _values(size) {}
+
+template <typename uintX_t>
+FittedAttributeVector<uintX_t>::FittedAttributeVector(std::vector<uintX_t>&& values) : _values(std::move(values)) {}
+
+template <typename uintX_t>
+ValueID FittedAttributeVector<uintX_t>::get(const size_t i) const {
+  return ValueID{_values[i]};
+}
+
+template <typename uintX_t>
+void FittedAttributeVector<uintX_t>::unpack(const size_t begin, const size_t count, ValueID* output) const {
+  DebugAssert(begin + count <= _values.size(), "Positions out of range");
+  const auto* const values = _values.data() + begin;
+  for (auto index = size_t{0}; index < count; ++index) {
+    output[index] = ValueID{values[index]};
+  }
+}
+
+template <typename uintX_t>
+void FittedAttributeVector<uintX_t>::set(const size_t i, const ValueID value_id) {
+  DebugAssert(value_id.t <= std::numeric_limits<uintX_t>::max(), "Value id does not fit into attribute vector");
+  _values[i] = static_cast<uintX_t>(value_id);
+}
+
+template <typename uintX_t>
+size_t FittedAttributeVector<uintX_t>::size() const {
+  return _values.size();
+}
+
+template <typename uintX_t>
+AttributeVectorWidth FittedAttributeVector<uintX_t>::width() const {
+  return sizeof(uintX_t);
+}
+
+template <typename uintX_t>
+size_t FittedAttributeVector<uintX_t>::estimate_memory_usage() const {
+  return sizeof(*this) + vector_memory_usage(_values);
+}
+
+template <typename uintX_t>
+const std::vector<uintX_t>& FittedAttributeVector<uintX_t>::values() const {
+  return _values;
+}
+
+std::shared_ptr<BaseAttributeVector> make_fitted_attribute_vector(const size_t dictionary_size, const size_t size) {
+  // the largest value id is dictionary_size - 1
+  if (dictionary_size <= size_t{std::numeric_limits<uint8_t>::max()} + 1) {
+    return std::make_shared<FittedAttributeVector<uint8_t>>(size);
+  }
+  if (dictionary_size <= size_t{std::numeric_limits<uint16_t>::max()} + 1) {
+    return std::make_shared<FittedAttributeVector<uint16_t>>(size);
+  }
+  Assert(dictionary_size <= std::numeric_limits<ValueID::base_type>::max(), "Dictionary is too large for ValueIDs");
+  return std::make_shared<FittedAttributeVector<uint32_t>>(size);
+}
+
+template class FittedAttributeVector<uint8_t>;
+template class FittedAttributeVector<uint16_t>;
+template class FittedAttributeVector<uint32_t>;
+
+}  // namespace opossum
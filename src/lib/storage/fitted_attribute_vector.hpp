@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FittedAttributeVector stores value ids in the smallest unsigned integer type (uint8_t, uint16_t, or uint32_t)
+// that is able to represent all value ids of a segment.
+template <typename uintX_t>
+class FittedAttributeVector : public BaseAttributeVector {
+ public:
+  // creates an attribute vector holding `size` value ids, all initialized to zero
+  explicit FittedAttributeVector(const size_t size);
+
+  // creates an attribute vector from existing value ids
+  explicit FittedAttributeVector(std::vector<uintX_t>&& values);
+
+  ValueID get(const size_t i) const final;
+
+  void unpack(const size_t begin, const size_t count, ValueID* output) const final;
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  size_t size() const final;
+
+  AttributeVectorWidth width() const final;
+
+  size_t estimate_memory_usage() const final;
+
+  // returns the underlying value ids, e.g., for tight loops that should not call get() for every row
+  const std::vector<uintX_t>& values() const;
+
+ protected:
+  std::vector<uintX_t> _values;
+};
+
+// creates a FittedAttributeVector with `size` entries that is wide enough to hold
+// all value ids of a dictionary with `dictionary_size` entries
+std::shared_ptr<BaseAttributeVector> make_fitted_attribute_vector(const size_t dictionary_size, const size_t size);
+
+}  // namespace opossum
@@ -0,0 +1,113 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "utils/size_estimation_utils.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment)
+    : _block_minima{std::make_shared<std::vector<T>>()},
+      _block_offsets{std::make_shared<std::vector<BitPackedAttributeVector>>()} {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  Assert(value_segment, "FrameOfReferenceSegment can only be created from a ValueSegment of the same type");
+
+  const auto& values = value_segment->values();
+  _size = values.size();
+  const auto block_count = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_minima->reserve(block_count);
+  _block_offsets->reserve(block_count);
+
+  for (auto block_begin = size_t{0}; block_begin < _size; block_begin += BLOCK_SIZE) {
+    const auto block_size = std::min(BLOCK_SIZE, _size - block_begin);
+    const auto block_values = values.cbegin() + block_begin;
+    const auto minmax = std::minmax_element(block_values, block_values + block_size);
+    const auto minimum = static_cast<UnsignedT>(*minmax.first);
+    const auto max_offset = uint64_t{static_cast<UnsignedT>(static_cast<UnsignedT>(*minmax.second) - minimum)};
+
+    Assert(max_offset <= std::numeric_limits<ValueID::base_type>::max(),
+           "Value range of a block is too wide for FrameOfReferenceSegment");
+
+    // the bit width of each block only depends on its own value range
+    auto offsets = BitPackedAttributeVector{max_offset + 1, block_size};
+    for (auto offset_in_block = size_t{0}; offset_in_block < block_size; ++offset_in_block) {
+      const auto offset = static_cast<UnsignedT>(static_cast<UnsignedT>(block_values[offset_in_block]) - minimum);
+      offsets.set(offset_in_block, ValueID{static_cast<ValueID::base_type>(offset)});
+    }
+
+    _block_minima->push_back(*minmax.first);
+    _block_offsets->push_back(std::move(offsets));
+  }
+}
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(
+    const std::shared_ptr<std::vector<T>>& block_minima,
+    const std::shared_ptr<std::vector<BitPackedAttributeVector>>& block_offsets)
+    : _block_minima{block_minima}, _block_offsets{block_offsets}, _size{0} {
+  Assert(_block_minima->size() == _block_offsets->size(), "Each block needs a minimum");
+  for (auto block_index = size_t{0}; block_index < _block_offsets->size(); ++block_index) {
+    const auto block_size = (*_block_offsets)[block_index].size();
+    Assert(block_size == BLOCK_SIZE || block_index + 1 == _block_offsets->size(), "Only the last block may be partial");
+    _size += block_size;
+  }
+}
+
+template <typename T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  return get(chunk_offset);
+}
+
+template <typename T>
+T FrameOfReferenceSegment<T>::get(const size_t chunk_offset) const {
+  const auto block_index = chunk_offset / BLOCK_SIZE;
+  const auto minimum = static_cast<UnsignedT>((*_block_minima)[block_index]);
+  const auto offset = (*_block_offsets)[block_index].get(chunk_offset % BLOCK_SIZE);
+  return static_cast<T>(static_cast<UnsignedT>(minimum + offset));
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::append(const AllTypeVariant&) {
+  Fail("FrameOfReferenceSegment is immutable");
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + sizeof(*_block_minima) + vector_memory_usage(*_block_minima) +
+                      sizeof(*_block_offsets) + vector_memory_usage(*_block_offsets);
+  for (const auto& offsets : *_block_offsets) memory_usage += vector_memory_usage(offsets.words());
+  return memory_usage;
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> FrameOfReferenceSegment<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<BitPackedAttributeVector>> FrameOfReferenceSegment<T>::block_offsets() const {
+  return _block_offsets;
+}
+
+// Frame-of-reference encoding is only defined for the integral types of data_types_macro
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceSegment is a segment type for integral columns (int, long) with narrow value ranges. The segment is
+// split into blocks of BLOCK_SIZE values. For each block, it stores the minimum and, for each row, the offset of the
+// value from that minimum. The offsets of each block are bit-packed with the width needed by that block, so a single
+// block with outliers does not widen the others. Random access stays O(1). All offsets must fit into 32 bits, i.e.,
+// no block may span a range larger than 2^32 - 1.
+template <typename T>
+class FrameOfReferenceSegment : public BaseSegment {
+  static_assert(std::is_integral_v<T>, "FrameOfReferenceSegment is only defined for integral types");
+
+ public:
+  static constexpr size_t BLOCK_SIZE = 2048;
+
+  // creates a frame-of-reference encoded segment from a given value segment
+  explicit FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a frame-of-reference encoded segment from existing block minima and per-block offsets
+  FrameOfReferenceSegment(const std::shared_ptr<std::vector<T>>& block_minima,
+                          const std::shared_ptr<std::vector<BitPackedAttributeVector>>& block_offsets);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // return the value at a certain position
+  T get(const size_t chunk_offset) const;
+
+  // frame-of-reference segments are immutable, appending fails
+  void append(const AllTypeVariant&) override;
+
+  // return the number of entries
+  size_t size() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  // returns the minimum of each block
+  std::shared_ptr<const std::vector<T>> block_minima() const;
+
+  // returns, for each block, the offsets of its values from the block's minimum
+  std::shared_ptr<const std::vector<BitPackedAttributeVector>> block_offsets() const;
+
+ protected:
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  std::shared_ptr<std::vector<T>> _block_minima;
+  std::shared_ptr<std::vector<BitPackedAttributeVector>> _block_offsets;
+  size_t _size;
+};
+
+}  // namespace opossum
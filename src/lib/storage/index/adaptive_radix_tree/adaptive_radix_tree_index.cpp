@@ -0,0 +1,148 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/normalized_key.hpp"
+
+namespace opossum {
+
+namespace {
+
+// encodes a value so that comparing the keys byte-wise yields the same order as comparing the values (see
+// utils/normalized_key.hpp)
+template <typename T>
+ARTKey make_key(const detail::IteratedValueType<T>& value) {
+  if constexpr (std::is_arithmetic_v<T>) {
+    auto key = ARTKey(sizeof(T));
+    write_normalized_key<T>(value, key.data());
+    return key;
+  }
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    // the terminator makes sure that no key is a prefix of another key
+    auto key = ARTKey(value.size() + 1);
+    write_normalized_key(value, key.data(), key.size());
+    return key;
+  }
+}
+
+// Builds the subtree for the sorted, distinct keys [first_key, last_key), whose first `depth` bytes have already been
+// consumed by the parents. The positions of keys[key_id] are [key_begins[key_id], key_begins[key_id + 1]).
+std::unique_ptr<ARTNode> build_node(const std::vector<ARTKey>& keys, const std::vector<size_t>& key_begins,
+                                    const size_t first_key, const size_t last_key, const size_t depth) {
+  const auto begin = key_begins[first_key];
+  const auto end = key_begins[last_key];
+
+  if (last_key - first_key == 1) return std::make_unique<ARTLeaf>(begin, end, keys[first_key]);
+
+  // As the keys are sorted, all of them share the bytes that the first and the last key share. Since no key is a
+  // prefix of another one, the first and the last key differ before either of them ends.
+  const auto& first = keys[first_key];
+  const auto& last = keys[last_key - 1];
+  auto prefix_end = depth;
+  while (first[prefix_end] == last[prefix_end]) ++prefix_end;
+  auto prefix = ARTKey(first.cbegin() + depth, first.cbegin() + prefix_end);
+
+  // group the keys by their byte after the prefix
+  auto children = ARTChildren{};
+  for (auto child_first_key = first_key; child_first_key < last_key;) {
+    const auto partial_key = keys[child_first_key][prefix_end];
+    auto child_last_key = child_first_key + 1;
+    while (child_last_key < last_key && keys[child_last_key][prefix_end] == partial_key) ++child_last_key;
+    children.emplace_back(partial_key, build_node(keys, key_begins, child_first_key, child_last_key, prefix_end + 1));
+    child_first_key = child_last_key;
+  }
+
+  // choose the smallest node type that fits all children
+  if (children.size() <= 4) return std::make_unique<ARTNode4>(begin, end, std::move(prefix), std::move(children));
+  if (children.size() <= 16) return std::make_unique<ARTNode16>(begin, end, std::move(prefix), std::move(children));
+  if (children.size() <= 48) return std::make_unique<ARTNode48>(begin, end, std::move(prefix), std::move(children));
+  return std::make_unique<ARTNode256>(begin, end, std::move(prefix), std::move(children));
+}
+
+}  // namespace
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(
+    const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index)
+    : BaseIndex{SegmentIndexType::AdaptiveRadixTree} {
+  Assert(segments_to_index.size() == 1, "AdaptiveRadixTreeIndex only works with a single segment");
+  _indexed_segment = segments_to_index.front();
+  const auto data_type = ChunkEncoder::get_data_type(*_indexed_segment);
+  Assert(data_type, "AdaptiveRadixTreeIndex does not support this segment type");
+
+  resolve_data_type(*data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    using ValueType = detail::IteratedValueType<ColumnDataType>;
+
+    // sort all positions by value, and by position within each value
+    auto entries = std::vector<std::pair<ValueType, ChunkOffset>>{};
+    entries.reserve(_indexed_segment->size());
+    segment_iterate<ColumnDataType>(*_indexed_segment, [&](const ChunkOffset chunk_offset, const ValueType& value) {
+      entries.emplace_back(value, chunk_offset);
+    });
+    std::sort(entries.begin(), entries.end());
+
+    // only distinct values get a key; key_begins has one more entry so that each key's positions form a range
+    auto keys = std::vector<ARTKey>{};
+    auto key_begins = std::vector<size_t>{};
+    _postings.reserve(entries.size());
+    for (auto entry_index = size_t{0}; entry_index < entries.size(); ++entry_index) {
+      if (entry_index == 0 || entries[entry_index].first != entries[entry_index - 1].first) {
+        keys.emplace_back(make_key<ColumnDataType>(entries[entry_index].first));
+        key_begins.emplace_back(entry_index);
+      }
+      _postings.emplace_back(entries[entry_index].second);
+    }
+    key_begins.emplace_back(entries.size());
+
+    if (!keys.empty()) _root = build_node(keys, key_begins, 0, keys.size(), 0);
+
+    _to_key = [](const AllTypeVariant& value) -> std::optional<std::pair<ARTKey, bool>> {
+      const auto cast_value = ceil_cast<ColumnDataType>(value);
+      if (!cast_value) return std::nullopt;
+      return std::pair{make_key<ColumnDataType>(cast_value->first), cast_value->second};
+    };
+  });
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _bound(values[0], false);
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _bound(values[0], true);
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _postings.cbegin(); }
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _postings.cend(); }
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_bound(const AllTypeVariant& value, const bool strict) const {
+  const auto key = _to_key(value);
+  if (!_root || !key) return _postings.cend();
+  // a value between two keys has no positions, so both of its bounds are the lower bound of the next greater key
+  return _postings.cbegin() + _root->bound(key->first, 0, strict && key->second);
+}
+
+std::vector<std::shared_ptr<const BaseSegment>> AdaptiveRadixTreeIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+size_t AdaptiveRadixTreeIndex::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _postings.capacity() * sizeof(ChunkOffset);
+  if (_root) bytes += _root->estimate_memory_usage();
+  return bytes;
+}
+
+}  // namespace opossum
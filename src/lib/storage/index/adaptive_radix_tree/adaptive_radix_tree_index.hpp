@@ -0,0 +1,58 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "adaptive_radix_tree_nodes.hpp"
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The adaptive radix tree index indexes a single segment of any encoding and data type. Unlike the GroupKeyIndex, it
+ * does not rely on a sorted dictionary, but orders the values itself:
+ *
+ *  - _postings holds the positions of all rows, sorted by value (and by position within each value)
+ *  - the tree maps each distinct value, encoded as a binary-comparable ARTKey, to the range of its positions in
+ *    _postings. Each node stores the range of all values below it, so lower_bound and upper_bound are answered with a
+ *    single root-to-leaf walk that follows one child per key byte.
+ *
+ * Keys are the big-endian bytes of the values, with the sign bit flipped for signed integers and all bits flipped for
+ * negative floating point numbers, so that comparing them byte-wise matches the order of the values. Strings are
+ * stored as their bytes followed by a zero byte; they must not contain zero bytes themselves.
+ *
+ * Compared to a std::map, inner nodes only grow as large as the number of their children (4, 16, 48, or 256) and
+ * shared key bytes are stored only once, so that the upper levels of the tree stay in cache.
+ */
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const final;
+
+  // returns an iterator to the first position whose value is >= (or > if `strict`) the given value
+  Iterator _bound(const AllTypeVariant& value, const bool strict) const;
+
+  std::shared_ptr<const BaseSegment> _indexed_segment;
+
+  // Converts a search value to the key of the smallest value of the indexed segment's data type that is not less than
+  // it, and whether the two are equal (see ceil_cast). Returns std::nullopt if the search value is greater than all
+  // values of that type.
+  std::function<std::optional<std::pair<ARTKey, bool>>(const AllTypeVariant&)> _to_key;
+
+  std::unique_ptr<ARTNode> _root;
+  std::vector<ChunkOffset> _postings;
+};
+
+}  // namespace opossum
@@ -0,0 +1,132 @@
+#include "adaptive_radix_tree_nodes.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns the byte of the key at the given position, or -1 if the key is shorter
+int key_byte(const ARTKey& key, const size_t position) { return position < key.size() ? key[position] : -1; }
+
+}  // namespace
+
+ARTNode::ARTNode(const size_t begin, const size_t end) : _begin{begin}, _end{end} {}
+
+size_t ARTNode::begin() const { return _begin; }
+
+size_t ARTNode::end() const { return _end; }
+
+ARTLeaf::ARTLeaf(const size_t begin, const size_t end, ARTKey key) : ARTNode{begin, end}, _key{std::move(key)} {}
+
+size_t ARTLeaf::bound(const ARTKey& key, const size_t /*depth*/, const bool strict) const {
+  // the bytes after the parent's partial key have not been compared yet (they might be cut off by path compression)
+  const auto matches = strict ? key < _key : !(_key < key);
+  return matches ? _begin : _end;
+}
+
+size_t ARTLeaf::estimate_memory_usage() const { return sizeof(*this) + _key.capacity(); }
+
+ARTInnerNode::ARTInnerNode(const size_t begin, const size_t end, ARTKey prefix)
+    : ARTNode{begin, end}, _prefix{std::move(prefix)} {}
+
+size_t ARTInnerNode::bound(const ARTKey& key, const size_t depth, const bool strict) const {
+  for (auto index = size_t{0}; index < _prefix.size(); ++index) {
+    const auto byte = key_byte(key, depth + index);
+    // all keys of this subtree are greater or smaller than the search key
+    if (byte < _prefix[index]) return _begin;
+    if (byte > _prefix[index]) return _end;
+  }
+
+  const auto child_depth = depth + _prefix.size();
+  const auto byte = key_byte(key, child_depth);
+  const auto [child, partial_key] = _first_child_from(byte);  // NOLINT
+  if (!child) return _end;
+  if (partial_key > byte) return child->begin();
+  return child->bound(key, child_depth + 1, strict);
+}
+
+template <size_t capacity>
+ARTSortedNode<capacity>::ARTSortedNode(const size_t begin, const size_t end, ARTKey prefix, ARTChildren children)
+    : ARTInnerNode{begin, end, std::move(prefix)}, _child_count{static_cast<uint8_t>(children.size())} {
+  DebugAssert(children.size() <= capacity, "Too many children for this node type");
+  for (auto index = size_t{0}; index < children.size(); ++index) {
+    _partial_keys[index] = children[index].first;
+    _children[index] = std::move(children[index].second);
+  }
+}
+
+template <size_t capacity>
+std::pair<const ARTNode*, uint8_t> ARTSortedNode<capacity>::_first_child_from(const int byte) const {
+  const auto partial_keys_end = _partial_keys.cbegin() + _child_count;
+  const auto iter = std::find_if(_partial_keys.cbegin(), partial_keys_end,
+                                 [&](const uint8_t partial_key) { return partial_key >= byte; });
+  if (iter == partial_keys_end) return {nullptr, 0};
+  return {_children[iter - _partial_keys.cbegin()].get(), *iter};
+}
+
+template <size_t capacity>
+size_t ARTSortedNode<capacity>::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _prefix.capacity();
+  for (auto index = size_t{0}; index < _child_count; ++index) {
+    bytes += _children[index]->estimate_memory_usage();
+  }
+  return bytes;
+}
+
+template class ARTSortedNode<4>;
+template class ARTSortedNode<16>;
+
+ARTNode48::ARTNode48(const size_t begin, const size_t end, ARTKey prefix, ARTChildren children)
+    : ARTInnerNode{begin, end, std::move(prefix)} {
+  DebugAssert(children.size() <= _children.size(), "Too many children for this node type");
+  _child_slots.fill(EMPTY_SLOT);
+  for (auto slot = size_t{0}; slot < children.size(); ++slot) {
+    _child_slots[children[slot].first] = static_cast<uint8_t>(slot);
+    _children[slot] = std::move(children[slot].second);
+  }
+}
+
+std::pair<const ARTNode*, uint8_t> ARTNode48::_first_child_from(const int byte) const {
+  for (auto partial_key = std::max(byte, 0); partial_key < 256; ++partial_key) {
+    const auto slot = _child_slots[partial_key];
+    if (slot != EMPTY_SLOT) return {_children[slot].get(), static_cast<uint8_t>(partial_key)};
+  }
+  return {nullptr, 0};
+}
+
+size_t ARTNode48::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _prefix.capacity();
+  for (const auto& child : _children) {
+    if (child) bytes += child->estimate_memory_usage();
+  }
+  return bytes;
+}
+
+ARTNode256::ARTNode256(const size_t begin, const size_t end, ARTKey prefix, ARTChildren children)
+    : ARTInnerNode{begin, end, std::move(prefix)} {
+  for (auto& [partial_key, child] : children) {  // NOLINT
+    _children[partial_key] = std::move(child);
+  }
+}
+
+std::pair<const ARTNode*, uint8_t> ARTNode256::_first_child_from(const int byte) const {
+  for (auto partial_key = std::max(byte, 0); partial_key < 256; ++partial_key) {
+    if (_children[partial_key]) return {_children[partial_key].get(), static_cast<uint8_t>(partial_key)};
+  }
+  return {nullptr, 0};
+}
+
+size_t ARTNode256::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + _prefix.capacity();
+  for (const auto& child : _children) {
+    if (child) bytes += child->estimate_memory_usage();
+  }
+  return bytes;
+}
+
+}  // namespace opossum
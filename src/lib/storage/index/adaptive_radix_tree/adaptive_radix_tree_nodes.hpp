@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Keys of the adaptive radix tree are byte strings whose lexicographical order equals the order of the indexed
+// values (see AdaptiveRadixTreeIndex for the encoding of each data type)
+using ARTKey = std::vector<uint8_t>;
+
+/**
+ * Nodes of the adaptive radix tree (Leis et al., "The Adaptive Radix Tree: ARTful Indexing for Main-Memory
+ * Databases", ICDE 2013). Each leaf holds one distinct key. Inner nodes hold up to 4, 16, 48, or 256 children, each
+ * addressed by the next byte (partial key) of their keys, and skip the bytes that all keys below them share (path
+ * compression).
+ *
+ * The tree is built once from sorted keys. Each node knows the range [begin, end) of the index's postings that its
+ * keys refer to, so that bounds can be answered without walking to the next leaf.
+ */
+class ARTNode : private Noncopyable {
+ public:
+  ARTNode(const size_t begin, const size_t end);
+  virtual ~ARTNode() = default;
+
+  // Returns the first posting position of a key in this subtree that is >= the search key (> if `strict`), or end()
+  // if there is none. The first `depth` bytes of the key have already been matched by the parent nodes.
+  virtual size_t bound(const ARTKey& key, const size_t depth, const bool strict) const = 0;
+
+  size_t begin() const;
+  size_t end() const;
+
+  // returns the number of bytes occupied by this node and its children
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  const size_t _begin;
+  const size_t _end;
+};
+
+class ARTLeaf : public ARTNode {
+ public:
+  ARTLeaf(const size_t begin, const size_t end, ARTKey key);
+
+  size_t bound(const ARTKey& key, const size_t depth, const bool strict) const final;
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  const ARTKey _key;
+};
+
+using ARTChildren = std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>>;
+
+class ARTInnerNode : public ARTNode {
+ public:
+  ARTInnerNode(const size_t begin, const size_t end, ARTKey prefix);
+
+  size_t bound(const ARTKey& key, const size_t depth, const bool strict) const final;
+
+ protected:
+  // Returns the child with the smallest partial key >= the given byte (-1 stands for "before all bytes") together
+  // with its partial key, or nullptr if there is none
+  virtual std::pair<const ARTNode*, uint8_t> _first_child_from(const int byte) const = 0;
+
+  // the bytes shared by all keys below this node, after the parent's partial key
+  const ARTKey _prefix;
+};
+
+// Node4 and Node16: partial keys and children in sorted arrays
+template <size_t capacity>
+class ARTSortedNode : public ARTInnerNode {
+ public:
+  ARTSortedNode(const size_t begin, const size_t end, ARTKey prefix, ARTChildren children);
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::pair<const ARTNode*, uint8_t> _first_child_from(const int byte) const final;
+
+  uint8_t _child_count;
+  std::array<uint8_t, capacity> _partial_keys{};
+  std::array<std::unique_ptr<ARTNode>, capacity> _children;
+};
+
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
+
+// Node48: a 256-entry array maps each byte to a slot in the 48 children
+class ARTNode48 : public ARTInnerNode {
+ public:
+  ARTNode48(const size_t begin, const size_t end, ARTKey prefix, ARTChildren children);
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  static constexpr uint8_t EMPTY_SLOT = 255;
+
+  std::pair<const ARTNode*, uint8_t> _first_child_from(const int byte) const final;
+
+  std::array<uint8_t, 256> _child_slots;
+  std::array<std::unique_ptr<ARTNode>, 48> _children;
+};
+
+// Node256: one child pointer per byte
+class ARTNode256 : public ARTInnerNode {
+ public:
+  ARTNode256(const size_t begin, const size_t end, ARTKey prefix, ARTChildren children);
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::pair<const ARTNode*, uint8_t> _first_child_from(const int byte) const final;
+
+  std::array<std::unique_ptr<ARTNode>, 256> _children;
+};
+
+}  // namespace opossum
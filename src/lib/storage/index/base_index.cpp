@@ -0,0 +1,34 @@
+#include "base_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseIndex::BaseIndex(const SegmentIndexType type) : _type{type} {}
+
+bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  return _get_indexed_segments() == segments;
+}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(!values.empty() && values.size() <= _get_indexed_segments().size(),
+              "Number of values must be between one and the number of indexed segments");
+  return _lower_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(!values.empty() && values.size() <= _get_indexed_segments().size(),
+              "Number of values must be between one and the number of indexed segments");
+  return _upper_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::cbegin() const { return _cbegin(); }
+
+BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
+
+SegmentIndexType BaseIndex::type() const { return _type; }
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "segment_index_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * BaseIndex is the abstract super class for all indexes on the segments of a chunk (see Chunk::create_index).
+ *
+ * An index covers one or more segments and allows finding the positions of all rows with a given (prefix of the)
+ * key without scanning the segments. The positions are accessed as a range of ChunkOffsets that is ordered by key,
+ * i.e., the rows of all values in [lower, upper) are found in [lower_bound(lower), lower_bound(upper)):
+ *
+ *   for (auto iter = index->lower_bound({5}); iter != index->upper_bound({10}); ++iter) { ... *iter ... }
+ *
+ * Indexes are immutable. They stay valid as long as they are referenced, as they keep the indexed segments alive.
+ */
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  explicit BaseIndex(const SegmentIndexType type);
+  virtual ~BaseIndex() = default;
+
+  // returns true if the index covers exactly the given segments, in this order
+  bool is_index_for(const std::vector<std::shared_ptr<const BaseSegment>>& segments) const;
+
+  // Returns an iterator to the position of the first row whose key is not smaller than the given values. Fewer values
+  // than indexed segments can be given, which then compare as a prefix of the key.
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // returns an iterator to the position of the first row whose key is greater than the given values
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // iterators over the positions of all rows, ordered by key
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  SegmentIndexType type() const;
+
+  // returns the number of bytes occupied by the index, without the indexed segments
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  virtual Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _cbegin() const = 0;
+  virtual Iterator _cend() const = 0;
+  virtual std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const = 0;
+
+ private:
+  const SegmentIndexType _type;
+};
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#include "group_key_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index)
+    : BaseIndex{SegmentIndexType::GroupKey} {
+  Assert(segments_to_index.size() == 1, "GroupKeyIndex only works with a single segment");
+  _indexed_segment = segments_to_index.front();
+
+  _dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(_indexed_segment);
+  if (!_dictionary_segment) {
+    // e.g., a run-length or frame-of-reference segment picked by the background encoding
+    const auto data_type = ChunkEncoder::get_data_type(*_indexed_segment);
+    Assert(data_type, "GroupKeyIndex does not support this segment type");
+    const auto segment = std::const_pointer_cast<BaseSegment>(_indexed_segment);
+    _dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(
+        ChunkEncoder::encode_segment(segment, *data_type, EncodingType::Dictionary));
+  }
+
+  const auto& attribute_vector = *_dictionary_segment->attribute_vector();
+
+  // count the occurrences of each value id, shifted by one so that the prefix sums yield the begin offsets
+  _offsets.resize(_dictionary_segment->unique_values_count() + 1);
+  attribute_vector_iterate(attribute_vector,
+                           [&](const ChunkOffset, const ValueID value_id) { ++_offsets[value_id + 1]; });
+  for (auto value_id = size_t{1}; value_id < _offsets.size(); ++value_id) {
+    _offsets[value_id] += _offsets[value_id - 1];
+  }
+
+  // place each position at the next free slot of its value id
+  auto next_positions = _offsets;
+  _postings.resize(attribute_vector.size());
+  attribute_vector_iterate(attribute_vector, [&](const ChunkOffset chunk_offset, const ValueID value_id) {
+    _postings[next_positions[value_id]++] = chunk_offset;
+  });
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _get_postings_iterator_at(_dictionary_segment->lower_bound(values[0]));
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _get_postings_iterator_at(_dictionary_segment->upper_bound(values[0]));
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_cbegin() const { return _postings.cbegin(); }
+
+GroupKeyIndex::Iterator GroupKeyIndex::_cend() const { return _postings.cend(); }
+
+GroupKeyIndex::Iterator GroupKeyIndex::_get_postings_iterator_at(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) return _postings.cend();
+  return _postings.cbegin() + _offsets[value_id];
+}
+
+std::vector<std::shared_ptr<const BaseSegment>> GroupKeyIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+size_t GroupKeyIndex::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + (_offsets.capacity() + _postings.capacity()) * sizeof(ChunkOffset);
+  if (_dictionary_segment != _indexed_segment) bytes += _dictionary_segment->estimate_memory_usage();
+  return bytes;
+}
+
+}  // namespace opossum
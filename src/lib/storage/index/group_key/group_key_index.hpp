@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+
+/**
+ * The group-key index indexes a single dictionary-encoded segment. As the dictionary is sorted, value ids are already
+ * ordered by value, so the index only has to group the positions by value id:
+ *
+ *  - _postings holds the positions of all rows, sorted by value id (and by position within each value id)
+ *  - _offsets[value_id] is the index of the first position of value_id in _postings. It has one additional entry
+ *    (the number of rows), so that the positions of value_id are [_offsets[value_id], _offsets[value_id + 1]).
+ *
+ * A lookup is a binary search in the dictionary followed by a single access to _offsets. The index is built with a
+ * counting sort in two passes over the attribute vector.
+ *
+ * Segments of other encodings (e.g., run-length segments picked by the background encoding) are dictionary-encoded
+ * into a copy that the index owns, so that it can be created on any chunk, at the cost of the copy's memory.
+ */
+class GroupKeyIndex : public BaseIndex {
+ public:
+  explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const final;
+
+  // returns an iterator to the first position of the value id, or cend() for INVALID_VALUE_ID
+  Iterator _get_postings_iterator_at(const ValueID value_id) const;
+
+  std::shared_ptr<const BaseSegment> _indexed_segment;
+  // the indexed segment if it is dictionary-encoded, or its dictionary-encoded copy otherwise
+  std::shared_ptr<const BaseDictionarySegment> _dictionary_segment;
+  std::vector<ChunkOffset> _offsets;
+  std::vector<ChunkOffset> _postings;
+};
+
+}  // namespace opossum
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace opossum {
+
+// identifies the concrete type of an index, see BaseIndex::type()
+enum class SegmentIndexType { GroupKey, AdaptiveRadixTree };
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#include "reference_segment.hpp"
+
+#include <memory>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
+                                   const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
+    : _referenced_table{referenced_table}, _referenced_column_id{referenced_column_id}, _pos_list{pos} {
+  Assert(_referenced_table && _pos_list, "ReferenceSegment needs a table and a position list");
+  Assert(_referenced_column_id < _referenced_table->column_count(), "Referenced column does not exist");
+  DebugAssert(!std::dynamic_pointer_cast<const ReferenceSegment>(
+                  _referenced_table->get_chunk(ChunkID{0}).get_segment(_referenced_column_id)),
+              "ReferenceSegments must not reference other ReferenceSegments");
+}
+
+AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  const auto& row_id = _pos_list->at(chunk_offset);
+  const auto& chunk = _referenced_table->get_chunk(row_id.chunk_id);
+  return (*chunk.get_segment(_referenced_column_id))[row_id.chunk_offset];
+}
+
+void ReferenceSegment::append(const AllTypeVariant&) { Fail("ReferenceSegment is immutable"); }
+
+size_t ReferenceSegment::size() const { return _pos_list->size(); }
+
+size_t ReferenceSegment::estimate_memory_usage() const { return sizeof(*this) + vector_memory_usage(*_pos_list); }
+
+const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table> ReferenceSegment::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceSegment::referenced_column_id() const { return _referenced_column_id; }
+
+}  // namespace opossum
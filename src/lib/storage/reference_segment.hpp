@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// ReferenceSegment is a segment type that does not store values itself, but points to the rows of another table. The
+// position list is usually shared by all segments of a chunk, so that operators like the TableScan can represent their
+// result as a table without copying any values, with a memory footprint of one RowID per row regardless of the number
+// of columns. ReferenceSegments always reference tables that store their data, never other ReferenceSegments.
+class ReferenceSegment : public BaseSegment {
+ public:
+  // creates a segment that references the given positions of a column of the referenced table
+  ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                   const std::shared_ptr<const PosList> pos);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // reference segments are immutable, appending fails
+  void append(const AllTypeVariant&) override;
+
+  // return the number of entries, i.e., of referenced positions
+  size_t size() const override;
+
+  // returns the size of the segment including its position list, which might be shared with other segments
+  size_t estimate_memory_usage() const override;
+
+  const std::shared_ptr<const PosList> pos_list() const;
+  const std::shared_ptr<const Table> referenced_table() const;
+  ColumnID referenced_column_id() const;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
+};
+
+}  // namespace opossum
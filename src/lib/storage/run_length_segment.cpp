@@ -0,0 +1,93 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "utils/size_estimation_utils.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment)
+    : _values{std::make_shared<std::vector<T>>()}, _end_positions{std::make_shared<std::vector<ChunkOffset>>()} {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  Assert(value_segment, "RunLengthSegment can only be created from a ValueSegment of the same type");
+
+  const auto segment_size = value_segment->size();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+    const auto& value = value_segment->get(chunk_offset);
+    if (_values->empty() || _values->back() != value) {
+      _values->emplace_back(value);
+      _end_positions->push_back(chunk_offset);
+    } else {
+      _end_positions->back() = chunk_offset;
+    }
+  }
+
+  _values->shrink_to_fit();
+  _end_positions->shrink_to_fit();
+}
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<std::vector<T>>& values,
+                                      const std::shared_ptr<std::vector<ChunkOffset>>& end_positions)
+    : _values{values}, _end_positions{end_positions} {
+  Assert(_values->size() == _end_positions->size(), "Each run needs a value and an end position");
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  return get(chunk_offset);
+}
+
+template <typename T>
+T RunLengthSegment<T>::get(const size_t chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Chunk offset out of range");
+
+  const auto iter = std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), chunk_offset);
+  return (*_values)[std::distance(_end_positions->cbegin(), iter)];
+}
+
+template <typename T>
+void RunLengthSegment<T>::append(const AllTypeVariant&) {
+  Fail("RunLengthSegment is immutable");
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::size() const {
+  if (_end_positions->empty()) return 0;
+  return _end_positions->back() + 1;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + sizeof(*_values) + vector_memory_usage(*_values) + sizeof(*_end_positions) +
+         vector_memory_usage(*_end_positions);
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_count() const {
+  return _values->size();
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<ChunkOffset>> RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is a segment type that stores consecutive equal values (runs) only once. For each run, it keeps
+// the value and the (inclusive) chunk offset at which the run ends. It is well suited for sorted or clustered columns.
+template <typename T>
+class RunLengthSegment : public BaseSegment {
+ public:
+  // creates a run-length encoded segment from a given value segment
+  explicit RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a run-length encoded segment from existing runs
+  RunLengthSegment(const std::shared_ptr<std::vector<T>>& values,
+                   const std::shared_ptr<std::vector<ChunkOffset>>& end_positions);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // return the value at a certain position, found by a binary search on the run ends
+  T get(const size_t chunk_offset) const;
+
+  // run-length segments are immutable, appending fails
+  void append(const AllTypeVariant&) override;
+
+  // return the number of entries
+  size_t size() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  // return the number of runs
+  size_t run_count() const;
+
+  // returns the value of each run
+  std::shared_ptr<const std::vector<T>> values() const;
+
+  // returns the last chunk offset of each run
+  std::shared_ptr<const std::vector<ChunkOffset>> end_positions() const;
+
+  // Calls functor(chunk_offset) for every position whose value satisfies predicate(value). The predicate is evaluated
+  // only once per run, so the cost of evaluation is independent of the run lengths.
+  template <typename Predicate, typename Functor>
+  void for_each_match(const Predicate& predicate, const Functor& functor) const {
+    auto run_begin = ChunkOffset{0};
+    for (auto run_index = size_t{0}; run_index < _values->size(); ++run_index) {
+      const auto run_end = (*_end_positions)[run_index];
+      if (predicate((*_values)[run_index])) {
+        for (auto chunk_offset = run_begin; chunk_offset <= run_end; ++chunk_offset) {
+          functor(chunk_offset);
+        }
+      }
+      run_begin = run_end + 1;
+    }
+  }
+
+ protected:
+  std::shared_ptr<std::vector<T>> _values;
+  std::shared_ptr<std::vector<ChunkOffset>> _end_positions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,245 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "base_segment.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "dictionary_segment.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+/**
+ * segment_iterate resolves the concrete segment type once and then calls
+ *
+ *   functor(const ChunkOffset chunk_offset, const auto& value)
+ *
+ * for every position of the segment in a tight loop, without virtual calls or AllTypeVariant construction per value.
+ * For string segments, the value is passed as a std::string_view, regardless of the segment type. ReferenceSegments
+ * pass the referenced values in the order of their position list, resolving the referenced segment once for each run
+ * of positions in the same chunk.
+ *
+ * Example:
+ *
+ *   auto sum = int64_t{0};
+ *   segment_iterate<int32_t>(*segment, [&](const ChunkOffset, const int32_t value) { sum += value; });
+ *
+ * If the data type is only known as a string, use the overload that resolves it first. The functor then has to be
+ * a generic lambda:
+ *
+ *   segment_iterate(*segment, table.column_type(column_id), [&](const ChunkOffset chunk_offset, const auto& value) {
+ *     std::cout << chunk_offset << ": " << value << std::endl;
+ *   });
+ */
+
+namespace detail {
+
+// For std::string, all segment types pass values as std::string_view
+template <typename T>
+using IteratedValueType = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+}  // namespace detail
+
+// Calls functor(chunk_offset, value_id) for every position of an attribute vector. Fitted attribute vectors are read
+// from their underlying vector, bit-packed ones are unpacked block-wise.
+template <typename Functor>
+void attribute_vector_iterate(const BaseAttributeVector& attribute_vector, const Functor& functor) {
+  const auto size = static_cast<ChunkOffset>(attribute_vector.size());
+
+  if (const auto* bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    auto block = BitPackedAttributeVector::Block{};
+    for (auto block_index = size_t{0}; block_index < bit_packed->block_count(); ++block_index) {
+      bit_packed->decode_block(block_index, block);
+      const auto block_begin = static_cast<ChunkOffset>(block_index * BitPackedAttributeVector::BLOCK_SIZE);
+      const auto block_end =
+          std::min(static_cast<ChunkOffset>(block_begin + BitPackedAttributeVector::BLOCK_SIZE), size);
+      for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+        functor(chunk_offset, block[chunk_offset - block_begin]);
+      }
+    }
+    return;
+  }
+
+  const auto iterate_fitted = [&](const auto& values) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      functor(chunk_offset, ValueID{values[chunk_offset]});
+    }
+  };
+
+  if (const auto* fitted = dynamic_cast<const FittedAttributeVector<uint8_t>*>(&attribute_vector)) {
+    iterate_fitted(fitted->values());
+  } else if (const auto* fitted = dynamic_cast<const FittedAttributeVector<uint16_t>*>(&attribute_vector)) {
+    iterate_fitted(fitted->values());
+  } else if (const auto* fitted = dynamic_cast<const FittedAttributeVector<uint32_t>*>(&attribute_vector)) {
+    iterate_fitted(fitted->values());
+  } else {
+    Fail("Unknown attribute vector type");
+  }
+}
+
+namespace detail {
+
+// Resolves the type of a segment that stores data (i.e., not a ReferenceSegment) and calls functor(get_value), where
+// get_value(chunk_offset) returns the value at an arbitrary position. Used for the random accesses of
+// ReferenceSegments.
+template <typename T, typename Functor>
+void segment_with_accessor(const BaseSegment& segment, const Functor& functor) {
+  using ValueType = IteratedValueType<T>;
+
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    functor([&](const ChunkOffset chunk_offset) { return ValueType{value_segment->get(chunk_offset)}; });
+    return;
+  }
+
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    const auto& attribute_vector = *dictionary_segment->attribute_vector();
+    functor([&](const ChunkOffset chunk_offset) { return ValueType{dictionary[attribute_vector.get(chunk_offset)]}; });
+    return;
+  }
+
+  if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    // get() would return a copy, but string values have to point into the segment
+    const auto& values = *run_length_segment->values();
+    const auto& end_positions = *run_length_segment->end_positions();
+    functor([&](const ChunkOffset chunk_offset) {
+      const auto run = std::lower_bound(end_positions.cbegin(), end_positions.cend(), chunk_offset);
+      return ValueType{values[run - end_positions.cbegin()]};
+    });
+    return;
+  }
+
+  if constexpr (std::is_integral_v<T>) {
+    if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      functor([&](const ChunkOffset chunk_offset) { return frame_of_reference_segment->get(chunk_offset); });
+      return;
+    }
+  }
+
+  Fail("Unknown segment type");
+}
+
+}  // namespace detail
+
+template <typename T, typename Functor>
+void segment_iterate(const BaseSegment& segment, const Functor& functor) {
+  using ValueType = detail::IteratedValueType<T>;
+
+  if (const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    const auto size = static_cast<ChunkOffset>(value_segment->size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      functor(chunk_offset, ValueType{value_segment->get(chunk_offset)});
+    }
+    return;
+  }
+
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    attribute_vector_iterate(*dictionary_segment->attribute_vector(),
+                             [&](const ChunkOffset chunk_offset, const ValueID value_id) {
+                               functor(chunk_offset, ValueType{dictionary[value_id]});
+                             });
+    return;
+  }
+
+  if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    const auto& values = *run_length_segment->values();
+    const auto& end_positions = *run_length_segment->end_positions();
+    auto chunk_offset = ChunkOffset{0};
+    for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+      const auto value = ValueType{values[run_index]};
+      for (; chunk_offset <= end_positions[run_index]; ++chunk_offset) {
+        functor(chunk_offset, value);
+      }
+    }
+    return;
+  }
+
+  if constexpr (std::is_integral_v<T>) {
+    if (const auto* frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      using UnsignedT = std::make_unsigned_t<T>;
+      constexpr auto block_size = FrameOfReferenceSegment<T>::BLOCK_SIZE;
+      const auto& block_minima = *frame_of_reference_segment->block_minima();
+      const auto& block_offsets = *frame_of_reference_segment->block_offsets();
+      for (auto block_index = size_t{0}; block_index < block_offsets.size(); ++block_index) {
+        const auto minimum = static_cast<UnsignedT>(block_minima[block_index]);
+        const auto block_begin = static_cast<ChunkOffset>(block_index * block_size);
+        attribute_vector_iterate(block_offsets[block_index],
+                                 [&](const ChunkOffset offset_in_block, const ValueID offset) {
+                                   functor(block_begin + offset_in_block,
+                                           static_cast<T>(static_cast<UnsignedT>(minimum + offset)));
+                                 });
+      }
+      return;
+    }
+  }
+
+  if (const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    const auto& pos_list = *reference_segment->pos_list();
+    const auto& referenced_table = *reference_segment->referenced_table();
+    const auto referenced_column_id = reference_segment->referenced_column_id();
+
+    auto position = size_t{0};
+    while (position < pos_list.size()) {
+      const auto chunk_id = pos_list[position].chunk_id;
+      auto run_end = position + 1;
+      while (run_end < pos_list.size() && pos_list[run_end].chunk_id == chunk_id) ++run_end;
+
+      const auto referenced_segment = referenced_table.get_chunk(chunk_id).get_segment(referenced_column_id);
+      detail::segment_with_accessor<T>(*referenced_segment, [&](const auto& get_value) {
+        for (; position < run_end; ++position) {
+          functor(static_cast<ChunkOffset>(position), get_value(pos_list[position].chunk_offset));
+        }
+      });
+    }
+    return;
+  }
+
+  Fail("Unknown segment type");
+}
+
+// Returns the segments that segment_iterate reads the values of a segment from, i.e., the segment itself or the
+// segments referenced by a ReferenceSegment. Holding them keeps the string_views passed by segment_iterate valid after
+// the iteration, even if the segments are replaced in their chunks by background encoding in the meantime.
+inline std::vector<std::shared_ptr<const BaseSegment>> iterated_segments(
+    const std::shared_ptr<const BaseSegment>& segment) {
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+  if (!reference_segment) return {segment};
+
+  const auto& pos_list = *reference_segment->pos_list();
+  const auto& referenced_table = *reference_segment->referenced_table();
+  auto segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+  for (auto position = size_t{0}; position < pos_list.size(); ++position) {
+    const auto chunk_id = pos_list[position].chunk_id;
+    if (position > 0 && pos_list[position - 1].chunk_id == chunk_id) continue;
+    segments.emplace_back(referenced_table.get_chunk(chunk_id).get_segment(reference_segment->referenced_column_id()));
+  }
+  return segments;
+}
+
+// Resolves the data type given as a string and calls segment_iterate<T>
+template <typename Functor>
+void segment_iterate(const BaseSegment& segment, const std::string& data_type, const Functor& functor) {
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    segment_iterate<ColumnDataType>(segment, functor);
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,175 @@
+#include "segment_statistics.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "chunk.hpp"
+#include "dictionary_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseSegmentStatistics::BaseSegmentStatistics(const size_t row_count, const size_t distinct_count)
+    : _row_count{row_count}, _distinct_count{distinct_count} {}
+
+size_t BaseSegmentStatistics::row_count() const { return _row_count; }
+
+size_t BaseSegmentStatistics::null_count() const { return 0; }
+
+size_t BaseSegmentStatistics::distinct_count() const { return _distinct_count; }
+
+template <typename T>
+SegmentStatistics<T>::SegmentStatistics(const BaseSegment& segment, const bool build_bloom_filter)
+    : BaseSegmentStatistics{segment.size(), 0} {
+  if (const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto& dictionary = *dictionary_segment->dictionary();
+    if (!dictionary.empty()) {
+      _min = dictionary.front();
+      _max = dictionary.back();
+    }
+    _distinct_count = dictionary.size();
+
+    if (build_bloom_filter) {
+      _bloom_filter.emplace(_distinct_count);
+      for (const auto& value : dictionary) _bloom_filter->insert(_hash(value));
+    }
+    return;
+  }
+
+  // for strings, the views point into the segment, which outlives this constructor
+  auto values = std::vector<detail::IteratedValueType<T>>{};
+  if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    values.assign(run_length_segment->values()->cbegin(), run_length_segment->values()->cend());
+  } else {
+    values.reserve(segment.size());
+    segment_iterate<T>(segment, [&](const ChunkOffset, const auto& value) { values.push_back(value); });
+  }
+  if (values.empty()) return;
+
+  std::sort(values.begin(), values.end());
+  _min = T(values.front());
+  _max = T(values.back());
+  const auto distinct_end = std::unique(values.begin(), values.end());
+  _distinct_count = std::distance(values.begin(), distinct_end);
+
+  if (build_bloom_filter) {
+    _bloom_filter.emplace(_distinct_count);
+    const auto hash = std::hash<detail::IteratedValueType<T>>{};
+    std::for_each(values.begin(), distinct_end, [&](const auto& value) { _bloom_filter->insert(hash(value)); });
+  }
+}
+
+template <typename T>
+SegmentStatistics<T>::SegmentStatistics(const T& min, const T& max, const size_t row_count,
+                                        const size_t distinct_count, std::optional<BloomFilter> bloom_filter)
+    : BaseSegmentStatistics{row_count, distinct_count}, _min{min}, _max{max}, _bloom_filter{std::move(bloom_filter)} {}
+
+template <typename T>
+bool SegmentStatistics<T>::can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  const auto* const typed_search_value = boost::get<T>(&search_value);
+  if (!typed_search_value) return false;
+  return can_prune(scan_type, *typed_search_value);
+}
+
+template <typename T>
+bool SegmentStatistics<T>::can_prune(const ScanType scan_type, const T& search_value) const {
+  if (_row_count == 0) return true;
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return !may_contain(search_value);
+    case ScanType::OpNotEquals:
+      return _min == search_value && _max == search_value;
+    case ScanType::OpLessThan:
+      return _min >= search_value;
+    case ScanType::OpLessThanEquals:
+      return _min > search_value;
+    case ScanType::OpGreaterThan:
+      return _max <= search_value;
+    case ScanType::OpGreaterThanEquals:
+      return _max < search_value;
+  }
+  Fail("Unknown scan type");
+  return false;
+}
+
+template <typename T>
+bool SegmentStatistics<T>::may_contain(const AllTypeVariant& value) const {
+  const auto* const typed_value = boost::get<T>(&value);
+  if (!typed_value) return true;
+  return may_contain(*typed_value);
+}
+
+template <typename T>
+bool SegmentStatistics<T>::may_contain(const T& value) const {
+  if (_row_count == 0 || value < _min || value > _max) return false;
+  return !_bloom_filter || _bloom_filter->may_contain(_hash(value));
+}
+
+template <typename T>
+bool SegmentStatistics<T>::has_bloom_filter() const {
+  return _bloom_filter.has_value();
+}
+
+template <typename T>
+const std::optional<BloomFilter>& SegmentStatistics<T>::bloom_filter() const {
+  return _bloom_filter;
+}
+
+template <typename T>
+size_t SegmentStatistics<T>::estimate_memory_usage() const {
+  auto bytes = sizeof(*this);
+  if constexpr (std::is_same_v<T, std::string>) {
+    // strings that do not fit into the small string optimization buffer allocate capacity + 1 bytes on the heap
+    const auto sso_capacity = std::string{}.capacity();
+    for (const auto* value : {&_min, &_max}) {
+      if (value->capacity() > sso_capacity) bytes += value->capacity() + 1;
+    }
+  }
+  // the filter object itself is part of *this
+  if (_bloom_filter) bytes += _bloom_filter->estimate_memory_usage() - sizeof(BloomFilter);
+  return bytes;
+}
+
+template <typename T>
+size_t SegmentStatistics<T>::_hash(const T& value) {
+  return std::hash<detail::IteratedValueType<T>>{}(value);
+}
+
+template <typename T>
+const T& SegmentStatistics<T>::min() const {
+  return _min;
+}
+
+template <typename T>
+const T& SegmentStatistics<T>::max() const {
+  return _max;
+}
+
+std::shared_ptr<BaseSegmentStatistics> create_segment_statistics(const BaseSegment& segment,
+                                                                 const std::string& data_type,
+                                                                 const bool build_bloom_filter) {
+  return make_shared_by_data_type<BaseSegmentStatistics, SegmentStatistics>(data_type, segment, build_bloom_filter);
+}
+
+void create_chunk_statistics(Chunk& chunk, const std::vector<std::string>& data_types) {
+  DebugAssert(data_types.size() == chunk.column_count(), "Number of data types does not match the number of segments");
+
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    if (chunk.get_segment_statistics(column_id)) continue;
+    chunk.set_segment_statistics(column_id, create_segment_statistics(*chunk.get_segment(column_id),
+                                                                      data_types[column_id]));
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(SegmentStatistics);
+
+}  // namespace opossum
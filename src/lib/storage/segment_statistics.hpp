@@ -0,0 +1,102 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "bloom_filter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+
+// Lightweight statistics of a single segment, also known as a zone map. They are computed when a chunk is finalized
+// (i.e., when it is full or added with Table::emplace_chunk) and stored in the chunk next to the segment, so that
+// scans can skip chunks whose value range cannot match a predicate (see Chunk::can_prune). Optionally, they include a
+// Bloom filter of the segment's values, which also allows skipping chunks for equality predicates on unsorted,
+// high-cardinality columns (see Chunk::may_contain).
+class BaseSegmentStatistics : private Noncopyable {
+ public:
+  virtual ~BaseSegmentStatistics() = default;
+
+  // Returns true if no value of the segment can satisfy `value <scan_type> search_value`. Only search values of the
+  // segment's data type are considered. For all others (e.g., a double compared to an int segment), false is
+  // returned, as converting them might change the result of the comparison.
+  virtual bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // Returns false if the segment definitely does not contain the value. Without a Bloom filter, only the value range
+  // is checked. As for can_prune(), values of other data types always return true.
+  virtual bool may_contain(const AllTypeVariant& value) const = 0;
+
+  virtual bool has_bloom_filter() const = 0;
+
+  // returns the number of bytes occupied by the statistics, including the Bloom filter
+  virtual size_t estimate_memory_usage() const = 0;
+
+  // returns the number of values that the statistics were computed for
+  size_t row_count() const;
+
+  // segments cannot hold NULL values yet, so this is always zero
+  size_t null_count() const;
+
+  // returns the number of distinct values in the segment
+  size_t distinct_count() const;
+
+ protected:
+  BaseSegmentStatistics(const size_t row_count, const size_t distinct_count);
+
+  size_t _row_count;
+  size_t _distinct_count;
+};
+
+template <typename T>
+class SegmentStatistics : public BaseSegmentStatistics {
+ public:
+  // Computes the statistics of the given segment, which has to be of data type T. For dictionary segments, the
+  // dictionary is used directly. For all others, the (run) values are copied and sorted. The Bloom filter takes
+  // BloomFilter::BITS_PER_VALUE bits per distinct value.
+  explicit SegmentStatistics(const BaseSegment& segment, const bool build_bloom_filter = true);
+
+  // restores statistics, e.g., from a binary table
+  SegmentStatistics(const T& min, const T& max, const size_t row_count, const size_t distinct_count,
+                    std::optional<BloomFilter> bloom_filter = std::nullopt);
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  // same as above, but without going through AllTypeVariant
+  bool can_prune(const ScanType scan_type, const T& search_value) const;
+
+  bool may_contain(const AllTypeVariant& value) const final;
+  bool may_contain(const T& value) const;
+
+  bool has_bloom_filter() const final;
+  const std::optional<BloomFilter>& bloom_filter() const;
+
+  size_t estimate_memory_usage() const final;
+
+  // the smallest and largest value of the segment. Undefined if the segment is empty.
+  const T& min() const;
+  const T& max() const;
+
+ protected:
+  // hashes values so that std::string and std::string_view (see segment_iterate) hash to the same value
+  static size_t _hash(const T& value);
+
+  T _min{};
+  T _max{};
+  std::optional<BloomFilter> _bloom_filter;
+};
+
+// creates the statistics of a segment whose data type is given as a string (e.g., table.column_type(column_id))
+std::shared_ptr<BaseSegmentStatistics> create_segment_statistics(const BaseSegment& segment,
+                                                                 const std::string& data_type,
+                                                                 const bool build_bloom_filter = true);
+
+// creates the statistics of all segments of the chunk that do not have statistics yet
+void create_chunk_statistics(Chunk& chunk, const std::vector<std::string>& data_types);
+
+}  // namespace opossum
@@ -1,47 +1,78 @@
 #include "storage_manager.hpp"
 
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "chunk_encoder.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
 StorageManager& StorageManager::get() {
-  return *(new StorageManager());
-  // A really hacky fix to get the tests to run - replace this with your implementation
+  static StorageManager instance;
+  return instance;
 }
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  // Implementation goes here
+  Assert(!has_table(name), "A table with the name " + name + " already exists");
+  _tables.emplace(name, table);
 }
 
 void StorageManager::drop_table(const std::string& name) {
-  // Implementation goes here
+  const auto erased_count = _tables.erase(name);
+  Assert(erased_count == 1, "No table with the name " + name);
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
-  // Implementation goes here
-  return nullptr;
+  const auto iter = _tables.find(name);
+  Assert(iter != _tables.cend(), "No table with the name " + name);
+  return iter->second;
 }
 
-bool StorageManager::has_table(const std::string& name) const {
-  // Implementation goes here
-  return false;
-}
+bool StorageManager::has_table(const std::string& name) const { return _tables.count(name) > 0; }
 
 std::vector<std::string> StorageManager::table_names() const {
-  throw std::runtime_error("Implement StorageManager::table_names");
+  std::vector<std::string> names;
+  names.reserve(_tables.size());
+  for (const auto& [name, table] : _tables) {
+    names.push_back(name);
+  }
+  return names;
 }
 
 void StorageManager::print(std::ostream& out) const {
-  // Implementation goes here
-}
+  for (const auto& [name, table] : _tables) {
+    out << name << " (" << table->column_count() << " columns, " << table->row_count() << " rows, "
+        << table->chunk_count() << " chunks, " << table->estimate_memory_usage() << " bytes)" << std::endl;
+
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto& data_type = table->column_type(column_id);
 
-void StorageManager::reset() {
-  // Implementation goes here;
+      // chunk count and bytes per encoding
+      auto usage_by_encoding = std::map<EncodingType, std::pair<size_t, size_t>>{};
+      auto column_bytes = size_t{0};
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        const auto segment = table->get_chunk(chunk_id).get_segment(column_id);
+        const auto bytes = segment->estimate_memory_usage();
+        auto& usage = usage_by_encoding[ChunkEncoder::get_encoding_type(segment, data_type)];
+        ++usage.first;
+        usage.second += bytes;
+        column_bytes += bytes;
+      }
+
+      out << "  " << table->column_name(column_id) << " (" << data_type << "): " << column_bytes << " bytes";
+      for (const auto& [encoding_type, usage] : usage_by_encoding) {
+        out << ", " << encoding_type_to_string(encoding_type) << ": " << usage.first << " chunks / " << usage.second
+            << " bytes";
+      }
+      out << std::endl;
+    }
+  }
 }
 
+void StorageManager::reset() { get() = StorageManager(); }
+
 }  // namespace opossum
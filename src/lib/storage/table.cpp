@@ -9,61 +9,221 @@
 #include <utility>
 #include <vector>
 
+#include "chunk_encoder.hpp"
+#include "reference_segment.hpp"
+#include "segment_statistics.hpp"
 #include "value_segment.hpp"
 
 #include "resolve_type.hpp"
+#include "statistics/table_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+Table::Table(const uint32_t chunk_size)
+    : _max_chunk_size{chunk_size}, _table_statistics{std::make_shared<TableStatistics>()} {
+  Assert(chunk_size > 0, "Chunk size must be greater than zero");
+  _chunks.push_back(std::make_shared<Chunk>());
+}
+
 void Table::add_column(const std::string& name, const std::string& type) {
-  // Implementation goes here
+  DebugAssert(row_count() == 0, "Columns can only be added to empty tables");
+
+  _column_names.push_back(name);
+  _column_types.push_back(type);
+  _table_statistics->add_column(type);
+
+  for (const auto& chunk : _chunks) {
+    chunk->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type, memory_resource()));
+  }
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
-  // Implementation goes here
+  _create_chunk_if_full();
+  _chunks.back()->append(values);
 }
 
-uint16_t Table::column_count() const {
-  // Implementation goes here
-  return 0;
+void Table::append_columns(std::vector<ColumnValues> columns) {
+  Assert(columns.size() == column_count(), "Number of columns does not match the table");
+  if (columns.empty()) return;
+
+  const auto row_count = boost::apply_visitor([](const auto& values) { return values.size(); }, columns.front());
+  for (const auto& column : columns) {
+    Assert(boost::apply_visitor([](const auto& values) { return values.size(); }, column) == row_count,
+           "All columns must have the same number of rows");
+  }
+
+  auto begin = size_t{0};
+  while (begin < row_count) {
+    _create_chunk_if_full();
+    const auto end = std::min(row_count, begin + (_max_chunk_size - _chunks.back()->size()));
+    _chunks.back()->append_columns(columns, begin, end);
+    begin = end;
+  }
 }
 
-uint64_t Table::row_count() const {
-  // Implementation goes here
-  return 0;
+void Table::_create_chunk_if_full() {
+  if (_last_chunk_finalized) {
+    // rows are never appended to a chunk that was added with emplace_chunk(), as its statistics are final
+    _chunks.push_back(_create_chunk());
+    _last_chunk_finalized = false;
+    return;
+  }
+  if (_chunks.back()->size() < _max_chunk_size) return;
+  _finalize_chunk(_chunks.back(), _background_encoding);
+  _chunks.push_back(_create_chunk());
 }
 
-ChunkID Table::chunk_count() const {
-  // Implementation goes here
-  return ChunkID{0};
+void Table::_finalize_chunk(const std::shared_ptr<Chunk>& chunk, const bool encode) {
+  if (!encode) {
+    auto has_all_statistics = true;
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      has_all_statistics &= chunk->get_segment_statistics(column_id) != nullptr;
+    }
+    if (has_all_statistics) return;
+  }
+
+  auto lock = std::unique_lock<std::mutex>{_encoding_queue->mutex};
+  _encoding_queue->chunks.emplace_back(chunk, encode);
+  if (_encoding_queue->worker_running) return;
+
+  // The previous thread has left its loop already. The column types are copied, as the table might be moved while the
+  // thread is running.
+  _encoding_queue->worker_running = true;
+  lock.unlock();
+  if (_encoding_worker.valid()) _encoding_worker.get();
+  _encoding_worker = std::async(std::launch::async, [queue = _encoding_queue, data_types = _column_types]() {
+    _encode_queued_chunks(*queue, data_types);
+  });
 }
 
-ColumnID Table::column_id_by_name(const std::string& column_name) const {
-  // Implementation goes here
-  return ColumnID{0};
+void Table::_encode_queued_chunks(EncodingQueue& queue, const std::vector<std::string>& data_types) {
+  auto lock = std::unique_lock<std::mutex>{queue.mutex};
+  while (!queue.chunks.empty()) {
+    const auto [chunk, encode] = queue.chunks.front();  // NOLINT
+    queue.chunks.pop_front();
+    lock.unlock();
+
+    try {
+      // encode_chunk() computes the statistics of the encoded segments
+      if (encode) ChunkEncoder::encode_chunk(chunk, data_types);
+      create_chunk_statistics(*chunk, data_types);
+    } catch (...) {
+      lock.lock();
+      if (!queue.error) queue.error = std::current_exception();
+      lock.unlock();
+    }
+    lock.lock();
+  }
+  queue.worker_running = false;
+  queue.worker_done.notify_all();
+}
+
+void Table::compress_chunk(ChunkID chunk_id) {
+  wait_for_background_encoding();
+  ChunkEncoder::encode_chunk(_chunks.at(chunk_id), _column_types, EncodingType::Dictionary);
 }
 
-uint32_t Table::max_chunk_size() const {
-  // Implementation goes here
-  return 0;
+void Table::set_background_encoding(const bool enabled) { _background_encoding = enabled; }
+
+void Table::wait_for_background_encoding() {
+  auto lock = std::unique_lock<std::mutex>{_encoding_queue->mutex};
+  _encoding_queue->worker_done.wait(lock, [&]() { return !_encoding_queue->worker_running; });
+  if (_encoding_queue->error) std::rethrow_exception(std::exchange(_encoding_queue->error, nullptr));
+}
+
+void Table::set_memory_resource(std::shared_ptr<std::pmr::memory_resource> memory_resource) {
+  Assert(row_count() == 0, "The memory resource can only be set for empty tables");
+  _memory_resource = std::move(memory_resource);
+
+  // the segments of the existing (empty) chunk were created with the previous resource
+  _chunks = {_create_chunk()};
 }
 
-const std::vector<std::string>& Table::column_names() const {
-  throw std::runtime_error("Implement Table::column_names()");
+std::pmr::memory_resource* Table::memory_resource() const {
+  return _memory_resource ? _memory_resource.get() : std::pmr::get_default_resource();
 }
 
-const std::string& Table::column_name(ColumnID column_id) const {
-  throw std::runtime_error("Implement Table::column_name");
+std::shared_ptr<Chunk> Table::_create_chunk() const {
+  auto chunk = std::make_shared<Chunk>();
+  for (const auto& type : _column_types) {
+    chunk->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type, memory_resource()));
+  }
+  return chunk;
+}
+
+uint16_t Table::column_count() const { return static_cast<uint16_t>(_column_names.size()); }
+
+uint64_t Table::row_count() const {
+  return std::accumulate(_chunks.cbegin(), _chunks.cend(), uint64_t{0},
+                         [](const uint64_t sum, const auto& chunk) { return sum + chunk->size(); });
 }
 
-const std::string& Table::column_type(ColumnID column_id) const {
-  throw std::runtime_error("Implement Table::column_type");
+size_t Table::estimate_memory_usage() const {
+  return std::accumulate(_chunks.cbegin(), _chunks.cend(), sizeof(*this),
+                         [](const size_t sum, const auto& chunk) { return sum + chunk->estimate_memory_usage(); });
 }
 
-Chunk& Table::get_chunk(ChunkID chunk_id) { throw std::runtime_error("Implement Table::get_chunk"); }
+ChunkID Table::chunk_count() const { return ChunkID{static_cast<ChunkID::base_type>(_chunks.size())}; }
 
-const Chunk& Table::get_chunk(ChunkID chunk_id) const { throw std::runtime_error("Implement Table::get_chunk"); }
+ColumnID Table::column_id_by_name(const std::string& column_name) const {
+  const auto iter = std::find(_column_names.cbegin(), _column_names.cend(), column_name);
+  Assert(iter != _column_names.cend(), "No column with name " + column_name);
+  return ColumnID{static_cast<ColumnID::base_type>(std::distance(_column_names.cbegin(), iter))};
+}
+
+uint32_t Table::max_chunk_size() const { return _max_chunk_size; }
+
+const std::vector<std::string>& Table::column_names() const { return _column_names; }
+
+const std::string& Table::column_name(ColumnID column_id) const { return _column_names.at(column_id); }
+
+const std::string& Table::column_type(ColumnID column_id) const { return _column_types.at(column_id); }
+
+Chunk& Table::get_chunk(ChunkID chunk_id) { return *_chunks.at(chunk_id); }
+
+const Chunk& Table::get_chunk(ChunkID chunk_id) const { return *_chunks.at(chunk_id); }
+
+void Table::emplace_chunk(Chunk chunk) {
+  if (_chunks.size() == 1 && _chunks.front()->size() == 0) {
+    _chunks.front() = std::make_shared<Chunk>(std::move(chunk));
+  } else {
+    _chunks.push_back(std::make_shared<Chunk>(std::move(chunk)));
+  }
+
+  // Intermediate results made of ReferenceSegments have no statistics of their own
+  if (_chunks.back()->size() > 0 && !_is_reference_chunk(*_chunks.back())) {
+    _finalize_chunk(_chunks.back(), false);
+    _last_chunk_finalized = true;
+  }
+}
+
+std::shared_ptr<const TableStatistics> Table::table_statistics() const {
+  const auto lock = std::lock_guard<std::mutex>{*_table_statistics_mutex};
+
+  // all chunks but the last one are complete, the last one once it is full or was added with emplace_chunk()
+  auto complete_chunk_count = _chunks.size() - 1;
+  if (_chunks.back()->size() == _max_chunk_size || _last_chunk_finalized) ++complete_chunk_count;
+  if (complete_chunk_count == _table_statistics_chunk_count) return _table_statistics;
+
+  // Estimates for chunks of ReferenceSegments should be derived from the statistics of the referenced tables
+  auto new_chunks = std::vector<std::shared_ptr<const Chunk>>{};
+  for (auto chunk_id = _table_statistics_chunk_count; chunk_id < complete_chunk_count; ++chunk_id) {
+    const auto& chunk = _chunks[chunk_id];
+    if (chunk->size() > 0 && !_is_reference_chunk(*chunk)) new_chunks.push_back(chunk);
+  }
+
+  // The statistics returned before are not modified, as they might be in use by other threads
+  auto table_statistics = _table_statistics->copy();
+  table_statistics->add_chunks(new_chunks);
+  _table_statistics = table_statistics;
+  _table_statistics_chunk_count = complete_chunk_count;
+  return _table_statistics;
+}
+
+bool Table::_is_reference_chunk(const Chunk& chunk) {
+  return chunk.column_count() > 0 && std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(ColumnID{0}));
+}
 
 }  // namespace opossum
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
 #include <limits>
 #include <map>
 #include <memory>
@@ -40,6 +44,9 @@ class Table : private Noncopyable {
   // Use approx_valid_row_count() for an approximate count of valid rows instead.
   uint64_t row_count() const;
 
+  // returns the number of bytes occupied by the table's data, i.e., all chunks and their segments
+  size_t estimate_memory_usage() const;
+
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
@@ -47,7 +54,8 @@ class Table : private Noncopyable {
   Chunk& get_chunk(ChunkID chunk_id);
   const Chunk& get_chunk(ChunkID chunk_id) const;
 
-  // Adds a chunk to the table. If the first chunk is empty, it is replaced.
+  // Adds a chunk to the table. If the first chunk is empty, it is replaced. The chunk is finalized, i.e., the segment
+  // statistics that it does not have yet are computed in the background and later rows are appended to a new chunk.
   void emplace_chunk(Chunk chunk);
 
   // Returns a list of all column names.
@@ -76,7 +84,84 @@ class Table : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(std::vector<AllTypeVariant> values);
 
+  // Inserts rows at the end of the table, given as one typed vector per column (e.g., pmr_vector<int32_t> for an
+  // "int" column). All vectors must have the same length. The values are moved into the segments and split across
+  // chunks at max_chunk_size(). Much faster than append() for large batches, but not thread-safe either.
+  // Note that the vectors are copied if `columns` is passed as a braced initializer list or if they use a different
+  // memory resource than the table.
+  void append_columns(std::vector<ColumnValues> columns);
+
+  // replaces all segments of the given chunk with dictionary-encoded segments
+  // the chunk must be full, i.e., no more values will be appended to it
+  void compress_chunk(ChunkID chunk_id);
+
+  // If enabled, append() hands every chunk that reached max_chunk_size() to the ChunkEncoder, which encodes it on a
+  // background thread. Enabled by default. Each table has at most one such thread, which works through the finalized
+  // chunks in order and ends when there are none left.
+  void set_background_encoding(const bool enabled);
+
+  // Blocks until all chunks handed to the background encoding have been encoded and the segment statistics of all
+  // finalized chunks have been computed. Rethrows the first error that occurred in the background.
+  void wait_for_background_encoding();
+
+  // Sets the memory resource that the value segments of this table allocate their values from, e.g., a
+  // MonotonicArena for bulk loads or an AlignedMemoryResource for frequently scanned tables (see
+  // utils/memory_resources.hpp). The table keeps the resource alive, so segments taken from the table must not outlive
+  // it. Can only be set as long as the table is empty. If no resource is set, std::pmr::get_default_resource() is used.
+  void set_memory_resource(std::shared_ptr<std::pmr::memory_resource> memory_resource);
+
+  std::pmr::memory_resource* memory_resource() const;
+
+  // Returns the statistics of the table for cardinality estimation. They are built when they are requested, so that
+  // appending and operators that never ask for them do not pay for them. Only complete chunks, i.e., full chunks and
+  // chunks added with emplace_chunk(), are included, so rows of the last, incomplete chunk are not. Chunks of
+  // ReferenceSegments are not included either. Chunks completed since the last call are added to a copy of the
+  // previous statistics, which remain unchanged.
+  std::shared_ptr<const TableStatistics> table_statistics() const;
+
  protected:
-  // Implementation goes here
+  // creates a chunk that holds an empty ValueSegment for each column
+  std::shared_ptr<Chunk> _create_chunk() const;
+
+  // starts a new chunk once the last one is full and finalizes the full chunk
+  void _create_chunk_if_full();
+
+  // Finalizes a chunk that is not written to anymore: a background job encodes it (if `encode` is set) and computes
+  // the segment statistics that are still missing (see Chunk::can_prune)
+  void _finalize_chunk(const std::shared_ptr<Chunk>& chunk, const bool encode);
+
+  static bool _is_reference_chunk(const Chunk& chunk);
+
+  // The finalized chunks that wait for the background thread, and whether they are encoded. The queue is shared with
+  // the thread, so that the table can be moved while the thread is running.
+  struct EncodingQueue {
+    std::mutex mutex;
+    std::condition_variable worker_done;
+    std::deque<std::pair<std::shared_ptr<Chunk>, bool>> chunks;
+    bool worker_running = false;
+    std::exception_ptr error;
+  };
+
+  // processes the chunks of the queue until it is empty
+  static void _encode_queued_chunks(EncodingQueue& queue, const std::vector<std::string>& data_types);
+
+  // declared before the chunks so that it is destroyed after them
+  std::shared_ptr<std::pmr::memory_resource> _memory_resource;
+
+  std::vector<std::shared_ptr<Chunk>> _chunks;
+  std::vector<std::string> _column_names;
+  std::vector<std::string> _column_types;
+  uint32_t _max_chunk_size;
+
+  // the statistics and the number of chunks they were built from, updated by table_statistics()
+  mutable std::shared_ptr<TableStatistics> _table_statistics;
+  mutable size_t _table_statistics_chunk_count = 0;
+  std::unique_ptr<std::mutex> _table_statistics_mutex = std::make_unique<std::mutex>();
+
+  bool _background_encoding = true;
+  bool _last_chunk_finalized = false;
+  std::shared_ptr<EncodingQueue> _encoding_queue = std::make_shared<EncodingQueue>();
+  // declared last, so that the destructor waits for the background thread before anything else is destroyed
+  std::future<void> _encoding_worker;
 };
 }  // namespace opossum
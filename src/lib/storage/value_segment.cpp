@@ -10,27 +10,81 @@
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/size_estimation_utils.hpp"
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(const PolymorphicAllocator<T>& allocator) : _values(allocator) {}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
 
-  throw std::runtime_error("Implement ValueSegment::operator[]");
+  return _values.at(chunk_offset);
 }
 
 template <typename T>
 void ValueSegment<T>::append(const AllTypeVariant& val) {
-  // Implementation goes here
+  _values.push_back(type_cast<T>(val));
 }
 
 template <typename T>
 size_t ValueSegment<T>::size() const {
-  // Implementation goes here
-  return 0;
+  return _values.size();
+}
+
+template <typename T>
+size_t ValueSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + vector_memory_usage(_values);
+}
+
+template <typename T>
+const pmr_vector<T>& ValueSegment<T>::values() const {
+  return _values;
+}
+
+ValueSegment<std::string>::ValueSegment(const PolymorphicAllocator<std::string>& allocator)
+    : _chars(allocator), _offsets({0}, allocator) {}
+
+ValueSegment<std::string>::ValueSegment(pmr_vector<char>&& chars, pmr_vector<size_t>&& offsets)
+    : _chars{std::move(chars)}, _offsets{std::move(offsets)} {
+  Assert(!_offsets.empty() && _offsets.front() == 0 && _offsets.back() == _chars.size(), "Invalid string offsets");
 }
 
-EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueSegment);
+AllTypeVariant ValueSegment<std::string>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  DebugAssert(chunk_offset < size(), "Chunk offset out of range");
+  return std::string{get(chunk_offset)};
+}
+
+void ValueSegment<std::string>::append(const AllTypeVariant& val) {
+  // Avoid creating a temporary std::string if the variant already holds one
+  if (const auto* const string = boost::get<std::string>(&val)) {
+    _chars.insert(_chars.end(), string->cbegin(), string->cend());
+  } else {
+    const auto converted = type_cast<std::string>(val);
+    _chars.insert(_chars.end(), converted.cbegin(), converted.cend());
+  }
+  _offsets.push_back(_chars.size());
+}
+
+size_t ValueSegment<std::string>::size() const { return _offsets.size() - 1; }
+
+size_t ValueSegment<std::string>::estimate_memory_usage() const {
+  return sizeof(*this) + vector_memory_usage(_chars) + vector_memory_usage(_offsets);
+}
+
+const pmr_vector<char>& ValueSegment<std::string>::chars() const { return _chars; }
+
+const pmr_vector<size_t>& ValueSegment<std::string>::offsets() const { return _offsets; }
+
+// ValueSegment<std::string> is an explicit specialization (see above). Instantiating it again would trigger
+// -Winstantiation-after-specialization in clang, so we cannot use EXPLICITLY_INSTANTIATE_DATA_TYPES here.
+template class ValueSegment<int32_t>;
+template class ValueSegment<int64_t>;
+template class ValueSegment<float>;
+template class ValueSegment<double>;
 
 }  // namespace opossum
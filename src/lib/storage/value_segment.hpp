@@ -1,5 +1,9 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <iterator>
 #include <memory>
 #include <string>
 #include <utility>
@@ -13,22 +17,107 @@ namespace opossum {
 template <typename T>
 class ValueSegment : public BaseSegment {
  public:
+  // All values are allocated through the given allocator, which can be created from any std::pmr::memory_resource*
+  explicit ValueSegment(const PolymorphicAllocator<T>& allocator = {});
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
   // add a value to the end
   void append(const AllTypeVariant& val) final;
 
+  // Add values to the end. If the segment is empty and the vector uses the same memory resource as the segment, the
+  // vector is taken over without copying.
+  void append_values(pmr_vector<T>&& values) {
+    if (_values.empty()) {
+      _values = std::move(values);
+    } else {
+      _values.insert(_values.end(), std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+    }
+  }
+
+  // add a range of values to the end
+  template <typename Iterator>
+  void append_values(Iterator begin, Iterator end) {
+    _values.insert(_values.end(), begin, end);
+  }
+
   // return the number of entries
   size_t size() const final;
 
+  size_t estimate_memory_usage() const final;
+
+  // Return the value at a certain position without going through AllTypeVariant. Generic code that has to work for
+  // all data types (including std::string, see below) should use this instead of values().
+  const T& get(const size_t chunk_offset) const { return _values[chunk_offset]; }
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  const pmr_vector<T>& values() const;
+
+ protected:
+  pmr_vector<T> _values;
+};
+
+// ValueSegment<std::string> does not keep a std::string per row. Instead, all characters are stored in one contiguous
+// buffer and the position of each value in that buffer is kept in an offsets vector. Value i spans the characters
+// [offsets[i], offsets[i + 1]). This avoids one heap allocation per (non-SSO) value and keeps scans sequential.
+template <>
+class ValueSegment<std::string> : public BaseSegment {
+ public:
+  explicit ValueSegment(const PolymorphicAllocator<std::string>& allocator = {});
+
+  // creates a segment from an existing character buffer and offsets, see chars() and offsets()
+  ValueSegment(pmr_vector<char>&& chars, pmr_vector<size_t>&& offsets);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // add a value to the end
+  void append(const AllTypeVariant& val) final;
+
+  // add values to the end
+  void append_values(pmr_vector<std::string>&& values) { append_values(values.cbegin(), values.cend()); }
+
+  // Add a range of values (e.g., std::string or std::string_view) to the end. Both buffers grow at most once.
+  template <typename Iterator>
+  void append_values(Iterator begin, Iterator end) {
+    auto char_count = size_t{0};
+    auto value_count = size_t{0};
+    for (auto iter = begin; iter != end; ++iter) {
+      char_count += iter->size();
+      ++value_count;
+    }
+    _chars.reserve(_chars.size() + char_count);
+    _offsets.reserve(_offsets.size() + value_count);
+
+    for (auto iter = begin; iter != end; ++iter) {
+      _chars.insert(_chars.end(), iter->cbegin(), iter->cend());
+      _offsets.push_back(_chars.size());
+    }
+  }
+
+  // return the number of entries
+  size_t size() const final;
+
+  size_t estimate_memory_usage() const final;
+
+  // Return the value at a certain position. The view is invalidated by the next append.
+  std::string_view get(const size_t chunk_offset) const {
+    const auto begin = _offsets[chunk_offset];
+    return std::string_view{_chars.data() + begin, _offsets[chunk_offset + 1] - begin};
+  }
+
+  // Return the characters of all values, without separators
+  const pmr_vector<char>& chars() const;
+
+  // Return the begin offset of each value in chars(), followed by the total number of characters
+  const pmr_vector<size_t>& offsets() const;
 
  protected:
-  // Implementation goes here
+  pmr_vector<char> _chars;
+  pmr_vector<size_t> _offsets;
 };
 
 }  // namespace opossum
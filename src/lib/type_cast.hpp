@@ -7,9 +7,15 @@
 #include <boost/hana/take_while.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <cmath>
+#include <limits>
+#include <optional>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include "all_type_variant.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -55,4 +61,63 @@ std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant&
   }
 }
 
+// Converts a search value for comparisons with values of type T. Unlike type_cast, it never rounds down, which would
+// change the result of comparisons such as `int_value < 3.5`: it returns the smallest T that is not less than the
+// value, and whether the two are equal (e.g., 4 and false for 3.5 and T = int32_t). If the value is greater than all
+// values of T, std::nullopt is returned. Strings and conversions from or to them use type_cast.
+template <typename T>
+std::optional<std::pair<T, bool>> ceil_cast(const AllTypeVariant& value) {
+  return boost::apply_visitor(
+      [&](const auto& typed_value) -> std::optional<std::pair<T, bool>> {
+        using ValueType = std::decay_t<decltype(typed_value)>;
+
+        if constexpr (std::is_same_v<ValueType, T> || !std::is_arithmetic_v<ValueType> || !std::is_arithmetic_v<T>) {
+          return std::pair{type_cast<T>(value), true};
+        } else {
+          if constexpr (std::is_floating_point_v<ValueType>) {
+            Assert(!std::isnan(typed_value), "Search value must not be NaN");
+          }
+
+          if constexpr (std::is_integral_v<T> && std::is_floating_point_v<ValueType>) {
+            // 2^digits is the first value above the range of T, and it is exactly representable as a floating-point
+            const auto limit = std::ldexp(ValueType{1}, std::numeric_limits<T>::digits);
+            const auto ceil_value = std::ceil(typed_value);
+            if (ceil_value >= limit) return std::nullopt;
+            if (ceil_value < -limit) return std::pair{std::numeric_limits<T>::lowest(), false};
+            return std::pair{static_cast<T>(ceil_value), ceil_value == typed_value};
+          } else if constexpr (std::is_integral_v<T>) {
+            // all integral data types are signed
+            const auto lowest = std::numeric_limits<T>::lowest();
+            if (typed_value > std::numeric_limits<T>::max()) return std::nullopt;
+            if (typed_value < lowest) return std::pair{lowest, false};
+            return std::pair{static_cast<T>(typed_value), true};
+          } else {
+            // T is floating-point, so doubles beyond the range of floats lie between its lowest value and infinity
+            const auto lowest = std::numeric_limits<T>::lowest();
+            const auto infinity = std::numeric_limits<T>::infinity();
+            if constexpr (std::is_floating_point_v<ValueType>) {
+              if (std::isinf(typed_value)) return std::pair{static_cast<T>(typed_value), true};
+              if (typed_value > std::numeric_limits<T>::max()) return std::pair{infinity, false};
+              if (typed_value < lowest) return std::pair{lowest, false};
+            }
+
+            auto cast_value = static_cast<T>(typed_value);
+            if constexpr (std::is_integral_v<ValueType>) {
+              // a large integer may round up to 2^digits, which cannot be converted back
+              const auto limit = std::ldexp(T{1}, std::numeric_limits<ValueType>::digits);
+              if (cast_value >= limit) return std::pair{cast_value, false};
+            }
+
+            // the conversion rounds to the nearest value, the next greater one is the smallest that is not less
+            const auto exact = static_cast<ValueType>(cast_value) == typed_value;
+            if (!exact && static_cast<ValueType>(cast_value) < typed_value) {
+              cast_value = std::nextafter(cast_value, infinity);
+            }
+            return std::pair{cast_value, exact};
+          }
+        }
+      },
+      value);
+}
+
 }  // namespace opossum
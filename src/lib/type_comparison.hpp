@@ -0,0 +1,38 @@
+#pragma once
+
+#include <functional>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Resolves a ScanType once and calls functor(comparator) with the matching transparent comparison function object,
+ * e.g., std::less<>{} for OpLessThan. Operators can then instantiate their inner loops for each comparison instead of
+ * switching over the ScanType per row:
+ *
+ *   with_comparator(scan_type, [&](auto comparator) {
+ *     for (...) { if (comparator(value, search_value)) ... }
+ *   });
+ */
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return functor(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return functor(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return functor(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return functor(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return functor(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return functor(std::greater_equal<>{});
+  }
+  Fail("Unknown scan type");
+}
+
+}  // namespace opossum
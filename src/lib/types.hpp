@@ -1,5 +1,8 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <memory_resource>
+
 #include <cstdint>
 #include <iostream>
 #include <limits>
@@ -35,8 +38,19 @@ STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
 namespace opossum {
 
 using ChunkOffset = uint32_t;
+
+// Segment storage is allocated through polymorphic allocators, so that tables can choose where their data lives
+// (see utils/memory_resources.hpp). A default-constructed allocator uses std::pmr::get_default_resource().
+template <typename T>
+using PolymorphicAllocator = std::pmr::polymorphic_allocator<T>;
+
+template <typename T>
+using pmr_vector = std::vector<T, PolymorphicAllocator<T>>;
 using AttributeVectorWidth = uint8_t;
 
+// ValueID returned by dictionary lookups if no matching value exists
+constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -0,0 +1,403 @@
+#include "binary_table.hpp"
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto MAGIC = std::string_view{"OPOSSUMB"};
+constexpr auto VERSION = uint32_t{2};
+
+// identifies the type of an attribute vector within a DictionarySegment
+enum class AttributeVectorType : uint8_t { Fitted, BitPacked };
+
+class BinaryWriter {
+ public:
+  explicit BinaryWriter(const std::string& file_name) : _stream{file_name, std::ios::binary | std::ios::trunc} {
+    Assert(_stream.is_open(), "export_binary: Could not open file " + file_name);
+  }
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written directly");
+    _stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  void write_string(const std::string_view string) {
+    write(uint64_t{string.size()});
+    _stream.write(string.data(), string.size());
+  }
+
+  template <typename T, typename Allocator>
+  void write_vector(const std::vector<T, Allocator>& values) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      // strings use the layout of ValueSegment<std::string>
+      auto offsets = std::vector<size_t>{0};
+      offsets.reserve(values.size() + 1);
+      for (const auto& value : values) offsets.push_back(offsets.back() + value.size());
+
+      write(uint64_t{offsets.back()});
+      for (const auto& value : values) _stream.write(value.data(), value.size());
+      write_vector(offsets);
+    } else {
+      write(uint64_t{values.size()});
+      _stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+  }
+
+  void close() {
+    _stream.close();
+    Assert(!_stream.fail(), "export_binary: Could not write file");
+  }
+
+ protected:
+  std::ofstream _stream;
+};
+
+class BinaryReader {
+ public:
+  explicit BinaryReader(const std::string_view data) : _data{data} {}
+
+  template <typename T>
+  T read() {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read directly");
+    Assert(sizeof(T) <= _data.size(), "import_binary: Unexpected end of file");
+    T value;
+    std::memcpy(&value, _data.data(), sizeof(T));
+    _data.remove_prefix(sizeof(T));
+    return value;
+  }
+
+  std::string_view read_string() {
+    const auto size = read<uint64_t>();
+    Assert(size <= _data.size(), "import_binary: Unexpected end of file");
+    const auto string = _data.substr(0, size);
+    _data.remove_prefix(size);
+    return string;
+  }
+
+  template <typename T, typename Vector = std::vector<T>>
+  Vector read_vector() {
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto chars = read_vector<char>();
+      const auto offsets = read_vector<size_t>();
+      Assert(!offsets.empty() && offsets.back() == chars.size(), "import_binary: Invalid string offsets");
+
+      auto values = std::vector<std::string>(offsets.size() - 1);
+      for (auto index = size_t{0}; index < values.size(); ++index) {
+        values[index].assign(chars.data() + offsets[index], offsets[index + 1] - offsets[index]);
+      }
+      return values;
+    } else {
+      const auto count = read<uint64_t>();
+      Assert(count <= _data.size() / sizeof(T), "import_binary: Unexpected end of file");
+      auto values = Vector(count);
+      std::memcpy(values.data(), _data.data(), count * sizeof(T));
+      _data.remove_prefix(count * sizeof(T));
+      return values;
+    }
+  }
+
+ protected:
+  std::string_view _data;
+};
+
+void write_bit_packed_attribute_vector(BinaryWriter& writer, const BitPackedAttributeVector& attribute_vector) {
+  writer.write(attribute_vector.bit_width());
+  writer.write(uint64_t{attribute_vector.size()});
+  writer.write_vector(attribute_vector.words());
+}
+
+std::shared_ptr<BitPackedAttributeVector> read_bit_packed_attribute_vector(BinaryReader& reader) {
+  const auto bit_width = reader.read<uint8_t>();
+  const auto size = reader.read<uint64_t>();
+  return std::make_shared<BitPackedAttributeVector>(bit_width, size, reader.read_vector<uint32_t>());
+}
+
+void write_attribute_vector(BinaryWriter& writer, const BaseAttributeVector& attribute_vector) {
+  if (const auto* bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    writer.write(AttributeVectorType::BitPacked);
+    write_bit_packed_attribute_vector(writer, *bit_packed);
+    return;
+  }
+
+  writer.write(AttributeVectorType::Fitted);
+  writer.write(attribute_vector.width());
+  if (const auto* fitted = dynamic_cast<const FittedAttributeVector<uint8_t>*>(&attribute_vector)) {
+    writer.write_vector(fitted->values());
+  } else if (const auto* fitted = dynamic_cast<const FittedAttributeVector<uint16_t>*>(&attribute_vector)) {
+    writer.write_vector(fitted->values());
+  } else if (const auto* fitted = dynamic_cast<const FittedAttributeVector<uint32_t>*>(&attribute_vector)) {
+    writer.write_vector(fitted->values());
+  } else {
+    Fail("export_binary: Unknown attribute vector type");
+  }
+}
+
+std::shared_ptr<BaseAttributeVector> read_attribute_vector(BinaryReader& reader) {
+  if (reader.read<AttributeVectorType>() == AttributeVectorType::BitPacked) {
+    return read_bit_packed_attribute_vector(reader);
+  }
+
+  switch (reader.read<AttributeVectorWidth>()) {
+    case 1:
+      return std::make_shared<FittedAttributeVector<uint8_t>>(reader.read_vector<uint8_t>());
+    case 2:
+      return std::make_shared<FittedAttributeVector<uint16_t>>(reader.read_vector<uint16_t>());
+    case 4:
+      return std::make_shared<FittedAttributeVector<uint32_t>>(reader.read_vector<uint32_t>());
+    default:
+      Fail("import_binary: Invalid attribute vector width");
+  }
+  return nullptr;
+}
+
+void write_segment(BinaryWriter& writer, const std::shared_ptr<BaseSegment>& segment, const std::string& data_type) {
+  const auto encoding_type = ChunkEncoder::get_encoding_type(segment, data_type);
+  writer.write(static_cast<uint8_t>(encoding_type));
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    switch (encoding_type) {
+      case EncodingType::Unencoded: {
+        const auto& value_segment = static_cast<const ValueSegment<ColumnDataType>&>(*segment);
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          writer.write_vector(value_segment.chars());
+          writer.write_vector(value_segment.offsets());
+        } else {
+          writer.write_vector(value_segment.values());
+        }
+        return;
+      }
+      case EncodingType::Dictionary: {
+        const auto& dictionary_segment = static_cast<const DictionarySegment<ColumnDataType>&>(*segment);
+        writer.write_vector(*dictionary_segment.dictionary());
+        write_attribute_vector(writer, *dictionary_segment.attribute_vector());
+        return;
+      }
+      case EncodingType::RunLength: {
+        const auto& run_length_segment = static_cast<const RunLengthSegment<ColumnDataType>&>(*segment);
+        writer.write_vector(*run_length_segment.values());
+        writer.write_vector(*run_length_segment.end_positions());
+        return;
+      }
+      case EncodingType::FrameOfReference: {
+        if constexpr (std::is_integral_v<ColumnDataType>) {
+          const auto& for_segment = static_cast<const FrameOfReferenceSegment<ColumnDataType>&>(*segment);
+          writer.write_vector(*for_segment.block_minima());
+          for (const auto& offsets : *for_segment.block_offsets()) write_bit_packed_attribute_vector(writer, offsets);
+        }
+        return;
+      }
+    }
+  });
+}
+
+std::shared_ptr<BaseSegment> read_segment(BinaryReader& reader, const std::string& data_type) {
+  const auto encoding_type = static_cast<EncodingType>(reader.read<uint8_t>());
+  std::shared_ptr<BaseSegment> segment;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    switch (encoding_type) {
+      case EncodingType::Unencoded: {
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          auto chars = reader.read_vector<char, pmr_vector<char>>();
+          auto offsets = reader.read_vector<size_t, pmr_vector<size_t>>();
+          segment = std::make_shared<ValueSegment<std::string>>(std::move(chars), std::move(offsets));
+        } else {
+          auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>();
+          value_segment->append_values(reader.read_vector<ColumnDataType, pmr_vector<ColumnDataType>>());
+          segment = value_segment;
+        }
+        return;
+      }
+      case EncodingType::Dictionary: {
+        auto dictionary = std::make_shared<std::vector<ColumnDataType>>(reader.read_vector<ColumnDataType>());
+        segment = std::make_shared<DictionarySegment<ColumnDataType>>(dictionary, read_attribute_vector(reader));
+        return;
+      }
+      case EncodingType::RunLength: {
+        auto values = std::make_shared<std::vector<ColumnDataType>>(reader.read_vector<ColumnDataType>());
+        auto end_positions = std::make_shared<std::vector<ChunkOffset>>(reader.read_vector<ChunkOffset>());
+        segment = std::make_shared<RunLengthSegment<ColumnDataType>>(values, end_positions);
+        return;
+      }
+      case EncodingType::FrameOfReference: {
+        if constexpr (std::is_integral_v<ColumnDataType>) {
+          auto block_minima = std::make_shared<std::vector<ColumnDataType>>(reader.read_vector<ColumnDataType>());
+          auto block_offsets = std::make_shared<std::vector<BitPackedAttributeVector>>();
+          block_offsets->reserve(block_minima->size());
+          for (auto block_index = size_t{0}; block_index < block_minima->size(); ++block_index) {
+            block_offsets->push_back(std::move(*read_bit_packed_attribute_vector(reader)));
+          }
+          segment = std::make_shared<FrameOfReferenceSegment<ColumnDataType>>(block_minima, block_offsets);
+        }
+        return;
+      }
+    }
+  });
+
+  Assert(segment, "import_binary: Invalid segment of type " + data_type);
+  return segment;
+}
+
+template <typename T>
+void write_value(BinaryWriter& writer, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    writer.write_string(value);
+  } else {
+    writer.write(value);
+  }
+}
+
+template <typename T>
+T read_value(BinaryReader& reader) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return std::string{reader.read_string()};
+  } else {
+    return reader.read<T>();
+  }
+}
+
+// the statistics are optional, e.g., for chunks whose statistics are still computed in the background
+void write_statistics(BinaryWriter& writer, const std::shared_ptr<const BaseSegmentStatistics>& statistics,
+                      const std::string& data_type) {
+  writer.write(uint8_t{statistics != nullptr});
+  if (!statistics) return;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& typed_statistics = static_cast<const SegmentStatistics<ColumnDataType>&>(*statistics);
+    writer.write(uint64_t{typed_statistics.row_count()});
+    writer.write(uint64_t{typed_statistics.distinct_count()});
+    write_value(writer, typed_statistics.min());
+    write_value(writer, typed_statistics.max());
+
+    const auto& bloom_filter = typed_statistics.bloom_filter();
+    writer.write(uint8_t{bloom_filter.has_value()});
+    if (bloom_filter) writer.write_vector(bloom_filter->words());
+  });
+}
+
+std::shared_ptr<BaseSegmentStatistics> read_statistics(BinaryReader& reader, const std::string& data_type) {
+  if (!reader.read<uint8_t>()) return nullptr;
+
+  std::shared_ptr<BaseSegmentStatistics> statistics;
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto row_count = reader.read<uint64_t>();
+    const auto distinct_count = reader.read<uint64_t>();
+    const auto min = read_value<ColumnDataType>(reader);
+    const auto max = read_value<ColumnDataType>(reader);
+
+    auto bloom_filter = std::optional<BloomFilter>{};
+    if (reader.read<uint8_t>()) bloom_filter.emplace(reader.read_vector<uint64_t>());
+
+    statistics = std::make_shared<SegmentStatistics<ColumnDataType>>(min, max, row_count, distinct_count,
+                                                                    std::move(bloom_filter));
+  });
+  return statistics;
+}
+
+}  // namespace
+
+void export_binary(const Table& table, const std::string& file_name) {
+  auto writer = BinaryWriter{file_name};
+
+  for (const auto character : MAGIC) writer.write(character);
+  writer.write(VERSION);
+  writer.write(table.max_chunk_size());
+  writer.write(table.column_count());
+  writer.write(table.chunk_count().t);
+
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    writer.write_string(table.column_name(column_id));
+    writer.write_string(table.column_type(column_id));
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    writer.write(chunk.size());
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      write_segment(writer, chunk.get_segment(column_id), table.column_type(column_id));
+    }
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      write_statistics(writer, chunk.get_segment_statistics(column_id), table.column_type(column_id));
+    }
+  }
+
+  writer.close();
+}
+
+std::shared_ptr<Table> import_binary(const std::string& file_name) {
+  const auto file = MappedFile{file_name};
+  auto reader = BinaryReader{file.content()};
+
+  for (const auto character : MAGIC) {
+    Assert(reader.read<char>() == character, "import_binary: " + file_name + " is not a binary table");
+  }
+  Assert(reader.read<uint32_t>() == VERSION, "import_binary: Unsupported version in " + file_name);
+
+  const auto max_chunk_size = reader.read<uint32_t>();
+  const auto column_count = reader.read<uint16_t>();
+  const auto chunk_count = reader.read<ChunkID::base_type>();
+
+  auto table = std::make_shared<Table>(max_chunk_size);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto name = reader.read_string();
+    const auto type = reader.read_string();
+    table->add_column(std::string{name}, std::string{type});
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto row_count = reader.read<uint32_t>();
+    Chunk chunk;
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto segment = read_segment(reader, table->column_type(column_id));
+      Assert(segment->size() == row_count, "import_binary: Segment size does not match the chunk size");
+      chunk.add_segment(segment);
+    }
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto statistics = read_statistics(reader, table->column_type(column_id));
+      Assert(!statistics || statistics->row_count() == row_count,
+             "import_binary: Statistics do not match the chunk size");
+      chunk.set_segment_statistics(column_id, statistics);
+    }
+    // chunks whose statistics were not stored get them from the table's background worker
+    table->emplace_chunk(std::move(chunk));
+  }
+
+  return table;
+}
+
+}  // namespace opossum
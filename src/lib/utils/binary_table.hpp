@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Binary table snapshots allow restarting without re-parsing text files. The file is column-oriented: for each chunk,
+ * the segments are written one after another in their in-memory layout (values, dictionaries, attribute vectors,
+ * run ends, block minima, bit-packed words), so that importing a segment mostly means copying memory from the mapped
+ * file. Encoded segments keep their encoding. The segment statistics are stored as well, so that they do not have to
+ * be recomputed on import.
+ *
+ * Layout (all integers in native byte order, so snapshots are only portable between machines of the same endianness):
+ *
+ *   header:   "OPOSSUMB" | version (uint32_t) | max chunk size (uint32_t) | column count (uint16_t)
+ *             | chunk count (uint32_t) | for each column: name | type
+ *   chunk:    row count (uint32_t) | for each column: segment | for each column: statistics
+ *   segment:  EncodingType (uint8_t) | encoding-specific data, see binary_table.cpp
+ *   statistics: present (uint8_t) | [row count (uint64_t) | distinct count (uint64_t) | min | max
+ *             | has Bloom filter (uint8_t) | [Bloom filter words]]
+ *
+ * Strings are stored as length (uint64_t) + characters. Vectors of values are stored as element count (uint64_t) +
+ * the raw elements; vectors of strings use the layout of ValueSegment<std::string> (offsets + characters).
+ */
+
+// writes the table to the given file, replacing the file if it exists
+void export_binary(const Table& table, const std::string& file_name);
+
+// memory-maps a file written by export_binary and creates a table from it
+std::shared_ptr<Table> import_binary(const std::string& file_name);
+
+}  // namespace opossum
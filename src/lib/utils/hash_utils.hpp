@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+namespace opossum {
+
+// Scrambles all bits of a hash value (finalizer of MurmurHash3). std::hash is the identity for integers in
+// libstdc++, which is not good enough for probabilistic data structures that derive bit positions from a hash.
+inline uint64_t mix_hash(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+}  // namespace opossum
@@ -1,11 +1,26 @@
 #include "load_table.hpp"
 
+// the linter wants these to be above everything else
+#include <charconv>
+#include <string_view>
+
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <future>
 #include <memory>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_statistics.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/mapped_file.hpp"
 
 namespace opossum {
 
@@ -31,4 +46,164 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
   return test_table;
 }
 
+namespace {
+
+// Removes a trailing carriage return (files written on Windows)
+std::string_view trim_line(std::string_view line) {
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+  return line;
+}
+
+// Splits the next line off the front of `data`
+std::string_view next_line(std::string_view& data) {
+  const auto end = std::min(data.find('\n'), data.size());
+  const auto line = data.substr(0, end);
+  data.remove_prefix(std::min(end + 1, data.size()));
+  return trim_line(line);
+}
+
+std::vector<std::string> split_header(std::string_view line) {
+  std::vector<std::string> fields;
+  while (true) {
+    const auto end = line.find('|');
+    fields.emplace_back(line.substr(0, end));
+    if (end == std::string_view::npos) break;
+    line.remove_prefix(end + 1);
+  }
+  return fields;
+}
+
+// Returns all lines of data. As in load_table(), empty lines are rows (and fail to parse unless the table has a single
+// column), only a line break at the very end does not start another row. Each worker searches a slice of the data for
+// line breaks.
+std::vector<std::string_view> split_lines_parallel(const std::string_view data, const size_t worker_count) {
+  const auto slice_size = (data.size() + worker_count - 1) / worker_count;
+
+  std::vector<std::future<std::vector<size_t>>> jobs;
+  for (auto slice_begin = size_t{0}; slice_begin < data.size(); slice_begin += slice_size) {
+    jobs.push_back(std::async(std::launch::async, [&data, slice_begin, slice_size]() {
+      const auto slice_end = std::min(slice_begin + slice_size, data.size());
+      std::vector<size_t> line_breaks;
+      auto position = data.find('\n', slice_begin);
+      while (position < slice_end) {
+        line_breaks.push_back(position);
+        position = data.find('\n', position + 1);
+      }
+      return line_breaks;
+    }));
+  }
+
+  std::vector<std::string_view> lines;
+  auto line_begin = size_t{0};
+  for (auto& job : jobs) {
+    for (const auto line_break : job.get()) {
+      lines.push_back(trim_line(data.substr(line_begin, line_break - line_begin)));
+      line_begin = line_break + 1;
+    }
+  }
+  if (line_begin < data.size()) lines.push_back(trim_line(data.substr(line_begin)));
+  return lines;
+}
+
+// Parses the given rows into a chunk with one ValueSegment per column, allocated from the given memory resource
+Chunk parse_chunk(const std::vector<std::string_view>& rows, const std::vector<std::string>& column_types,
+                  std::pmr::memory_resource* const memory_resource) {
+  const auto column_count = column_types.size();
+
+  // fields are stored row by row: field i of row r is at r * column_count + i
+  std::vector<std::string_view> fields;
+  fields.reserve(rows.size() * column_count);
+  for (const auto& row : rows) {
+    auto remainder = row;
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      const auto end = remainder.find('|');
+      // Assert() would build the message for every field, so we only do so on failure
+      if ((end == std::string_view::npos) != (column_id + 1 == column_count)) {
+        Fail("load_table_parallel: Wrong number of fields in line " + std::string(row));
+      }
+      fields.push_back(remainder.substr(0, end));
+      remainder.remove_prefix(std::min(end + 1, remainder.size()));
+    }
+  }
+
+  Chunk chunk;
+  for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(column_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      auto segment = std::make_shared<ValueSegment<ColumnDataType>>(memory_resource);
+
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        std::vector<std::string_view> values(rows.size());
+        for (auto row_index = size_t{0}; row_index < rows.size(); ++row_index) {
+          values[row_index] = fields[row_index * column_count + column_id];
+        }
+        segment->append_values(values.cbegin(), values.cend());
+      } else {
+        auto values = pmr_vector<ColumnDataType>(rows.size(), memory_resource);
+        for (auto row_index = size_t{0}; row_index < rows.size(); ++row_index) {
+          const auto& field = fields[row_index * column_count + column_id];
+          const auto result = std::from_chars(field.data(), field.data() + field.size(), values[row_index]);
+          if (result.ec != std::errc() || result.ptr != field.data() + field.size()) {
+            Fail("load_table_parallel: Could not parse '" + std::string(field) + "' as " + column_types[column_id]);
+          }
+        }
+        segment->append_values(std::move(values));
+      }
+
+      chunk.add_segment(segment);
+    });
+  }
+  return chunk;
+}
+
+}  // namespace
+
+std::shared_ptr<Table> load_table_parallel(const std::string& file_name, size_t chunk_size, size_t worker_count,
+                                           std::shared_ptr<std::pmr::memory_resource> memory_resource) {
+  if (worker_count == 0) worker_count = std::max(1u, std::thread::hardware_concurrency());
+
+  const auto file = MappedFile{file_name};
+  auto data = file.content();
+
+  const auto column_names = split_header(next_line(data));
+  const auto column_types = split_header(next_line(data));
+  Assert(column_names.size() == column_types.size(), "load_table_parallel: Column names and types do not match");
+
+  auto table = std::make_shared<Table>(chunk_size);
+  if (memory_resource) table->set_memory_resource(std::move(memory_resource));
+  for (auto column_id = size_t{0}; column_id < column_names.size(); ++column_id) {
+    table->add_column(column_names[column_id], column_types[column_id]);
+  }
+
+  const auto lines = split_lines_parallel(data, worker_count);
+  const auto chunk_count = (lines.size() + chunk_size - 1) / chunk_size;
+
+  // Each worker repeatedly claims the next chunk-sized range of rows and parses it
+  std::vector<Chunk> chunks(chunk_count);
+  std::atomic<size_t> next_chunk{0};
+  std::vector<std::future<void>> workers;
+  for (auto worker_id = size_t{0}; worker_id < std::min(worker_count, chunk_count); ++worker_id) {
+    workers.push_back(std::async(std::launch::async, [&]() {
+      for (auto chunk_index = next_chunk++; chunk_index < chunk_count; chunk_index = next_chunk++) {
+        const auto rows_begin = lines.cbegin() + chunk_index * chunk_size;
+        const auto rows_end = lines.cbegin() + std::min((chunk_index + 1) * chunk_size, lines.size());
+        chunks[chunk_index] =
+            parse_chunk(std::vector<std::string_view>(rows_begin, rows_end), column_types, table->memory_resource());
+        // the statistics are computed here, so that emplace_chunk() below does not have to. As it does not encode
+        // chunks either, the segments stay in the table's memory resource.
+        create_chunk_statistics(chunks[chunk_index], column_types);
+      }
+    }));
+  }
+  for (auto& worker : workers) {
+    // get() rethrows parsing errors
+    worker.get();
+  }
+
+  for (auto& chunk : chunks) {
+    table->emplace_chunk(std::move(chunk));
+  }
+  return table;
+}
+
 }  // namespace opossum
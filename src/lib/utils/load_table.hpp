@@ -1,5 +1,8 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <memory_resource>
+
 #include <memory>
 #include <sstream>
 #include <string>
@@ -25,4 +28,14 @@ std::vector<T> _split(const std::string& str, char delimiter) {
 // This is a helper method which is heavily used in our test suite
 std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size);
 
+// Loads the same .tbl format as load_table, but is meant for large files: The file is memory-mapped, line boundaries
+// are searched in parallel, and each chunk-sized range of rows is parsed by one of up to worker_count workers
+// directly into typed segments (using std::from_chars for numbers). If worker_count is zero, one worker per hardware
+// thread is used. If a memory resource is given, the table allocates its segments from it (see
+// Table::set_memory_resource). As the workers allocate concurrently, the resource has to be thread-safe. Unlike the
+// chunks of load_table(), the chunks are not encoded in the background, so that their ValueSegments stay in that
+// resource. Use Table::compress_chunk to encode them.
+std::shared_ptr<Table> load_table_parallel(const std::string& file_name, size_t chunk_size, size_t worker_count = 0,
+                                           std::shared_ptr<std::pmr::memory_resource> memory_resource = nullptr);
+
 }  // namespace opossum
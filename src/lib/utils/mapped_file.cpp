@@ -0,0 +1,36 @@
+#include "mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MappedFile::MappedFile(const std::string& file_name) {
+  const auto file_descriptor = open(file_name.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "MappedFile: Could not find file " + file_name);
+
+  // the mapping stays valid after the file is closed, so it is closed before any of the checks below can throw
+  struct stat file_stat;
+  const auto stat_result = fstat(file_descriptor, &file_stat);
+  _size = stat_result == 0 ? static_cast<size_t>(file_stat.st_size) : 0;
+  if (_size > 0) _data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  close(file_descriptor);
+
+  Assert(stat_result == 0, "MappedFile: Could not stat file " + file_name);
+  Assert(_data != MAP_FAILED, "MappedFile: Could not map file " + file_name);
+  if (_data != nullptr) madvise(_data, _size, MADV_SEQUENTIAL);
+}
+
+MappedFile::~MappedFile() {
+  if (_data != nullptr) munmap(_data, _size);
+}
+
+std::string_view MappedFile::content() const { return std::string_view{static_cast<const char*>(_data), _size}; }
+
+}  // namespace opossum
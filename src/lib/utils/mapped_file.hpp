@@ -0,0 +1,26 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Maps a file into memory (read-only) for the lifetime of the object. Pages are loaded lazily by the OS when they
+// are first accessed.
+class MappedFile : private Noncopyable {
+ public:
+  explicit MappedFile(const std::string& file_name);
+  ~MappedFile();
+
+  std::string_view content() const;
+
+ protected:
+  void* _data = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
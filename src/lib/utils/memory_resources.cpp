@@ -0,0 +1,59 @@
+#include "memory_resources.hpp"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace opossum {
+
+AlignedMemoryResource::AlignedMemoryResource(const bool use_huge_pages) : _use_huge_pages{use_huge_pages} {}
+
+bool AlignedMemoryResource::uses_huge_pages() const { return _use_huge_pages; }
+
+void* AlignedMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+  const auto use_huge_pages = _use_huge_pages && bytes >= HUGE_PAGE_SIZE;
+  alignment = std::max(alignment, use_huge_pages ? HUGE_PAGE_SIZE : CACHE_LINE_SIZE);
+
+  // std::aligned_alloc requires the size to be a multiple of the alignment
+  const auto aligned_bytes = (std::max(bytes, size_t{1}) + alignment - 1) / alignment * alignment;
+  auto* const pointer = std::aligned_alloc(alignment, aligned_bytes);
+  if (!pointer) throw std::bad_alloc{};
+
+#ifdef MADV_HUGEPAGE
+  // only a hint, the kernel might not have transparent huge pages enabled
+  if (use_huge_pages) madvise(pointer, aligned_bytes, MADV_HUGEPAGE);
+#endif
+
+  return pointer;
+}
+
+void AlignedMemoryResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) { std::free(pointer); }
+
+bool AlignedMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  // memory of all instances is released with std::free, so any instance can deallocate it
+  return dynamic_cast<const AlignedMemoryResource*>(&other) != nullptr;
+}
+
+MonotonicArena::MonotonicArena(const size_t initial_block_size, std::pmr::memory_resource* const upstream)
+    : _resource{initial_block_size, upstream} {}
+
+void MonotonicArena::release() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _resource.release();
+}
+
+void* MonotonicArena::do_allocate(size_t bytes, size_t alignment) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _resource.allocate(bytes, alignment);
+}
+
+void MonotonicArena::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+  // memory is only released all at once, see release()
+}
+
+bool MonotonicArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept { return this == &other; }
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <memory_resource>
+
+#include <cstddef>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Memory resources that a Table can use for its value segments (see Table::set_memory_resource).
+ *
+ * AlignedMemoryResource aligns every allocation to (at least) a cache line, so that vectorized kernels can use
+ * aligned loads. If huge pages are requested, large allocations are aligned to HUGE_PAGE_SIZE and the kernel is
+ * advised to back them with transparent huge pages, which reduces TLB misses when scanning large columns.
+ *
+ * MonotonicArena hands out memory from large blocks and only releases it once the arena is destroyed. This makes
+ * allocations during bulk loads almost free, but memory of segments that are replaced (e.g., by encoding) or grow is
+ * not reused. It is thread-safe, so parallel loaders can share it.
+ */
+class AlignedMemoryResource : public std::pmr::memory_resource {
+ public:
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+  static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+  explicit AlignedMemoryResource(const bool use_huge_pages = false);
+
+  bool uses_huge_pages() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  const bool _use_huge_pages;
+};
+
+class MonotonicArena : public std::pmr::memory_resource {
+ public:
+  // The blocks of the arena are requested from the upstream resource, which has to outlive the arena
+  explicit MonotonicArena(const size_t initial_block_size = 1024 * 1024,
+                          std::pmr::memory_resource* const upstream = std::pmr::get_default_resource());
+
+  // returns all memory to the upstream resource, invalidating everything allocated from the arena
+  void release();
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  std::mutex _mutex;
+  std::pmr::monotonic_buffer_resource _resource;
+};
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <string_view>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace opossum {
+
+/**
+ * Normalized keys encode values as byte strings whose byte-wise order (e.g., by std::memcmp) is the order of the
+ * values. Indexes and sort operators can then compare keys of any type, and keys that concatenate several columns,
+ * without resolving types or comparing value by value:
+ *
+ *  - integers are stored big-endian with the sign bit flipped,
+ *  - floating-point numbers are stored like unsigned integers, with negative numbers bit-inverted so that they are
+ *    ordered by descending magnitude (-0.0 is stored as 0.0, NaNs are not supported),
+ *  - strings are stored as their bytes followed by zero bytes, so that a string is ordered before its extensions
+ *    (strings that contain zero bytes are not supported). Long strings can be stored as a prefix of a fixed size and
+ *    a length byte instead, whose order is the order of the strings unless both are longer than the prefix.
+ *
+ * Inverting all bytes of a key reverses the order, e.g., for descending sort orders.
+ */
+
+namespace detail {
+
+template <typename UnsignedT>
+void write_big_endian(const UnsignedT bits, uint8_t* key) {
+  for (auto byte_index = size_t{0}; byte_index < sizeof(UnsignedT); ++byte_index) {
+    key[byte_index] = static_cast<uint8_t>(bits >> ((sizeof(UnsignedT) - 1 - byte_index) * 8));
+  }
+}
+
+}  // namespace detail
+
+// writes the sizeof(T) bytes of the normalized key of a number
+template <typename T>
+void write_normalized_key(const T value, uint8_t* key) {
+  if constexpr (std::is_integral_v<T>) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    constexpr auto sign_bit = UnsignedT{1} << (sizeof(T) * 8 - 1);
+    detail::write_big_endian(static_cast<UnsignedT>(static_cast<UnsignedT>(value) ^ sign_bit), key);
+  }
+
+  if constexpr (std::is_floating_point_v<T>) {
+    using UnsignedT = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = UnsignedT{1} << (sizeof(T) * 8 - 1);
+    // -0.0 and 0.0 compare equal, so they must get the same key
+    const auto canonical_value = value == T{0} ? T{0} : value;
+    auto bits = UnsignedT{};
+    std::memcpy(&bits, &canonical_value, sizeof(T));
+    bits = (bits & sign_bit) ? static_cast<UnsignedT>(~bits) : static_cast<UnsignedT>(bits | sign_bit);
+    detail::write_big_endian(bits, key);
+  }
+}
+
+// Writes the normalized key of a string, padded with zero bytes to key_size bytes. key_size must be larger than the
+// string, so that no key is a prefix of another key.
+inline void write_normalized_key(const std::string_view value, uint8_t* key, const size_t key_size) {
+  std::memcpy(key, value.data(), value.size());
+  std::memset(key + value.size(), 0, key_size - value.size());
+}
+
+// Writes the first prefix_size bytes of a string, padded with zero bytes, followed by a byte that holds the length of
+// the string, capped at prefix_size + 1. The length byte orders a string of prefix_size bytes before its extensions, so
+// two keys are only equal for different strings if both strings are longer than prefix_size. prefix_size must be
+// below 255.
+inline void write_normalized_key_prefix(const std::string_view value, uint8_t* key, const size_t prefix_size) {
+  const auto length = std::min(value.size(), prefix_size + 1);
+  write_normalized_key(value.substr(0, prefix_size), key, prefix_size + 1);
+  key[prefix_size] = static_cast<uint8_t>(length);
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace opossum {
+
+// Calls functor(task_index) for every task_index in [0, task_count) on up to std::thread::hardware_concurrency()
+// threads. Each worker claims the next task as soon as it is done, so tasks of different sizes (e.g., chunks or
+// partitions) are balanced across the workers. Exceptions thrown by the functor are rethrown.
+template <typename Functor>
+void parallel_for(const size_t task_count, const Functor& functor) {
+  const auto worker_count = std::min(size_t{std::max(1u, std::thread::hardware_concurrency())}, task_count);
+  if (worker_count <= 1) {
+    for (auto task_index = size_t{0}; task_index < task_count; ++task_index) {
+      functor(task_index);
+    }
+    return;
+  }
+
+  auto next_task = std::atomic<size_t>{0};
+  auto workers = std::vector<std::future<void>>{};
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    workers.push_back(std::async(std::launch::async, [&]() {
+      for (auto task_index = next_task++; task_index < task_count; task_index = next_task++) {
+        functor(task_index);
+      }
+    }));
+  }
+  for (auto& worker : workers) {
+    // get() rethrows errors of the workers
+    worker.get();
+  }
+}
+
+}  // namespace opossum
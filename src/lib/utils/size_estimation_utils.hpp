@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace opossum {
+
+// Returns the number of bytes allocated by a vector, including the heap memory of strings that do not fit into the
+// small string optimization buffer. The size of the vector object itself is not included.
+template <typename T, typename Allocator>
+size_t vector_memory_usage(const std::vector<T, Allocator>& vector) {
+  auto bytes = vector.capacity() * sizeof(T);
+  if constexpr (std::is_same_v<T, std::string>) {
+    // std::string{} has the capacity of the SSO buffer, longer strings allocate capacity + 1 bytes on the heap
+    const auto sso_capacity = std::string{}.capacity();
+    for (const auto& string : vector) {
+      if (string.capacity() > sso_capacity) bytes += string.capacity() + 1;
+    }
+  }
+  return bytes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,253 @@
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/aggregate.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/type_cast.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "float");
+    table->add_column("d", "long");
+    table->add_column("e", "int");
+    for (auto i = 0; i < 95; ++i) {
+      table->append({i % 4, "value" + std::to_string(i % 3), i * 0.5f, int64_t{i * 7 % 11 - 5}, -(i % 5)});
+    }
+    // dictionary segments are grouped on their value ids
+    for (auto chunk_id = ChunkID{0}; chunk_id < 9; chunk_id += 2) table->compress_chunk(chunk_id);
+
+    table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+  }
+
+  // computes the expected result by collecting the rows of each group
+  std::shared_ptr<Table> _expected_aggregate(const Table& table,
+                                             const std::vector<AggregateColumnDefinition>& aggregates,
+                                             const std::vector<ColumnID>& group_by_column_ids) {
+    auto groups = std::map<std::vector<AllTypeVariant>, std::vector<std::vector<AllTypeVariant>>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        auto row = std::vector<AllTypeVariant>{};
+        for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+          row.emplace_back((*chunk.get_segment(column_id))[chunk_offset]);
+        }
+        auto key = std::vector<AllTypeVariant>{};
+        for (const auto& column_id : group_by_column_ids) key.emplace_back(row[column_id]);
+        groups[key].emplace_back(std::move(row));
+      }
+    }
+
+    auto expected = std::make_shared<Table>();
+    for (const auto& column_id : group_by_column_ids) {
+      expected->add_column(table.column_name(column_id), table.column_type(column_id));
+    }
+    for (const auto& aggregate : aggregates) {
+      const auto& type = aggregate.column_id ? table.column_type(*aggregate.column_id) : "";
+      const auto argument = aggregate.column_id ? table.column_name(*aggregate.column_id) : "*";
+      const auto is_integer = type == "int" || type == "long";
+      switch (aggregate.function) {
+        case AggregateFunction::Count:
+          expected->add_column("COUNT(" + argument + ")", "long");
+          break;
+        case AggregateFunction::Sum:
+          expected->add_column("SUM(" + argument + ")", is_integer ? "long" : "double");
+          break;
+        case AggregateFunction::Avg:
+          expected->add_column("AVG(" + argument + ")", "double");
+          break;
+        case AggregateFunction::Min:
+          expected->add_column("MIN(" + argument + ")", type);
+          break;
+        case AggregateFunction::Max:
+          expected->add_column("MAX(" + argument + ")", type);
+          break;
+      }
+    }
+
+    for (const auto& [key, rows] : groups) {  // NOLINT
+      auto output_row = key;
+      for (const auto& aggregate : aggregates) {
+        auto values = std::vector<AllTypeVariant>{};
+        for (const auto& row : rows) values.emplace_back(row[aggregate.column_id.value_or(ColumnID{0})]);
+        const auto& type = aggregate.column_id ? table.column_type(*aggregate.column_id) : "";
+        const auto is_integer = type == "int" || type == "long";
+        auto integer_sum = int64_t{0};
+        auto sum = 0.0;
+        for (const auto& value : values) {
+          if (is_integer) integer_sum += type_cast<int64_t>(value);
+          if (type != "string") sum += type_cast<double>(value);
+        }
+
+        switch (aggregate.function) {
+          case AggregateFunction::Count:
+            output_row.emplace_back(static_cast<int64_t>(values.size()));
+            break;
+          case AggregateFunction::Sum:
+            output_row.emplace_back(is_integer ? AllTypeVariant{integer_sum} : AllTypeVariant{sum});
+            break;
+          case AggregateFunction::Avg:
+            output_row.emplace_back(sum / static_cast<double>(values.size()));
+            break;
+          case AggregateFunction::Min:
+            output_row.emplace_back(*std::min_element(values.cbegin(), values.cend()));
+            break;
+          case AggregateFunction::Max:
+            output_row.emplace_back(*std::max_element(values.cbegin(), values.cend()));
+            break;
+        }
+      }
+      expected->append(output_row);
+    }
+    return expected;
+  }
+
+  void _check_aggregate(const std::shared_ptr<const AbstractOperator>& in,
+                        const std::vector<AggregateColumnDefinition>& aggregates,
+                        const std::vector<ColumnID>& group_by_column_ids) {
+    auto aggregate = std::make_shared<Aggregate>(in, aggregates, group_by_column_ids);
+    aggregate->execute();
+    EXPECT_TABLE_EQ(aggregate->get_output(), _expected_aggregate(*in->get_output(), aggregates, group_by_column_ids));
+  }
+
+  const std::vector<AggregateColumnDefinition> all_aggregates{
+      {std::nullopt, AggregateFunction::Count}, {ColumnID{2}, AggregateFunction::Sum},
+      {ColumnID{3}, AggregateFunction::Sum},    {ColumnID{0}, AggregateFunction::Avg},
+      {ColumnID{1}, AggregateFunction::Min},    {ColumnID{3}, AggregateFunction::Min},
+      {ColumnID{1}, AggregateFunction::Max},    {ColumnID{2}, AggregateFunction::Max},
+      {ColumnID{4}, AggregateFunction::Count}};
+
+  std::shared_ptr<TableWrapper> table_wrapper;
+};
+
+TEST_F(OperatorsAggregateTest, OutputColumns) {
+  auto aggregate = std::make_shared<Aggregate>(table_wrapper, all_aggregates, std::vector<ColumnID>{ColumnID{1}});
+  aggregate->execute();
+  EXPECT_EQ(aggregate->aggregates().size(), all_aggregates.size());
+  EXPECT_EQ(aggregate->group_by_column_ids(), std::vector<ColumnID>{ColumnID{1}});
+
+  const auto& output = *aggregate->get_output();
+  EXPECT_EQ(output.column_names(),
+            (std::vector<std::string>{"b", "COUNT(*)", "SUM(c)", "SUM(d)", "AVG(a)", "MIN(b)", "MIN(d)", "MAX(b)",
+                                      "MAX(c)", "COUNT(e)"}));
+  EXPECT_EQ(output.column_type(ColumnID{0}), "string");
+  EXPECT_EQ(output.column_type(ColumnID{1}), "long");
+  EXPECT_EQ(output.column_type(ColumnID{2}), "double");
+  EXPECT_EQ(output.column_type(ColumnID{3}), "long");
+  EXPECT_EQ(output.column_type(ColumnID{4}), "double");
+  EXPECT_EQ(output.column_type(ColumnID{5}), "string");
+  EXPECT_EQ(output.column_type(ColumnID{8}), "float");
+  EXPECT_EQ(output.row_count(), 3u);
+}
+
+TEST_F(OperatorsAggregateTest, NoGroupBy) {
+  _check_aggregate(table_wrapper, all_aggregates, {});
+}
+
+TEST_F(OperatorsAggregateTest, GroupByOnly) {
+  _check_aggregate(table_wrapper, {}, {ColumnID{0}, ColumnID{1}});
+}
+
+TEST_F(OperatorsAggregateTest, GroupBySingleColumn) {
+  for (auto column_id = ColumnID{0}; column_id < 5; ++column_id) {
+    SCOPED_TRACE(column_id.t);
+    _check_aggregate(table_wrapper, all_aggregates, {column_id});
+  }
+}
+
+TEST_F(OperatorsAggregateTest, PackedIntegerGroupBy) {
+  // the negative values of e must survive packing
+  _check_aggregate(table_wrapper, all_aggregates, {ColumnID{4}, ColumnID{0}});
+}
+
+TEST_F(OperatorsAggregateTest, GroupByManyColumns) {
+  // the codes of d (64 bits) do not fit next to those of a and e
+  _check_aggregate(table_wrapper, all_aggregates, {ColumnID{0}, ColumnID{4}, ColumnID{3}, ColumnID{1}});
+  _check_aggregate(table_wrapper, all_aggregates, {ColumnID{3}, ColumnID{2}, ColumnID{0}, ColumnID{1}, ColumnID{4}});
+}
+
+TEST_F(OperatorsAggregateTest, LowCardinalityDictionarySegments) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("category", "string");
+  table->add_column("amount", "int");
+  table->add_column("price", "float");
+  for (auto i = 0; i < 1'000; ++i) {
+    table->append({"category" + std::to_string(i % 7), i % 13 - 6, static_cast<float>(i % 5) * 0.25f});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+  auto wrapper = std::make_shared<TableWrapper>(table);
+  wrapper->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{
+      {ColumnID{1}, AggregateFunction::Sum}, {ColumnID{2}, AggregateFunction::Avg},
+      {ColumnID{0}, AggregateFunction::Min}, {ColumnID{0}, AggregateFunction::Max},
+      {ColumnID{1}, AggregateFunction::Min}, {ColumnID{2}, AggregateFunction::Max}};
+  _check_aggregate(wrapper, aggregates, {});
+  _check_aggregate(wrapper, aggregates, {ColumnID{0}});
+  _check_aggregate(wrapper, aggregates, {ColumnID{2}, ColumnID{0}});
+}
+
+TEST_F(OperatorsAggregateTest, ReferenceInput) {
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{2}, ScanType::OpGreaterThan, 10.0f);
+  scan->execute();
+  _check_aggregate(scan, all_aggregates, {ColumnID{1}, ColumnID{0}});
+}
+
+TEST_F(OperatorsAggregateTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, -1);
+  scan->execute();
+
+  // an ungrouped aggregate returns a single row, with COUNT 0 and the other aggregates unset
+  auto aggregate = std::make_shared<Aggregate>(scan, all_aggregates, std::vector<ColumnID>{});
+  aggregate->execute();
+  const auto& output = *aggregate->get_output();
+  ASSERT_EQ(output.row_count(), 1u);
+  EXPECT_EQ(output.column_count(), all_aggregates.size());
+  const auto& chunk = output.get_chunk(ChunkID{0});
+  const auto expected_row = std::vector<AllTypeVariant>{
+      int64_t{0}, 0.0, int64_t{0}, 0.0, std::string{}, int64_t{0}, std::string{}, 0.0f, int64_t{0}};
+  for (auto column_id = ColumnID{0}; column_id < output.column_count(); ++column_id) {
+    EXPECT_EQ((*chunk.get_segment(column_id))[0], expected_row[column_id]);
+  }
+
+  // a grouped aggregate has no groups
+  auto grouped_aggregate = std::make_shared<Aggregate>(scan, all_aggregates, std::vector<ColumnID>{ColumnID{1}});
+  grouped_aggregate->execute();
+  EXPECT_EQ(grouped_aggregate->get_output()->row_count(), 0u);
+  EXPECT_EQ(grouped_aggregate->get_output()->column_count(), all_aggregates.size() + 1);
+}
+
+TEST_F(OperatorsAggregateTest, InvalidAggregates) {
+  const auto no_group_by = std::vector<ColumnID>{};
+  EXPECT_THROW(Aggregate(table_wrapper, {}, no_group_by), std::exception);
+  EXPECT_THROW(Aggregate(table_wrapper, {{std::nullopt, AggregateFunction::Sum}}, no_group_by), std::exception);
+
+  auto string_sum = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}}, no_group_by);
+  EXPECT_THROW(string_sum->execute(), std::exception);
+
+  auto invalid_column = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{7}, AggregateFunction::Min}}, no_group_by);
+  EXPECT_THROW(invalid_column->execute(), std::exception);
+
+  auto invalid_group_by = std::make_shared<Aggregate>(table_wrapper, std::vector<AggregateColumnDefinition>{},
+                                                      std::vector<ColumnID>{ColumnID{5}});
+  EXPECT_THROW(invalid_group_by->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/get_table.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsGetTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = load_table("src/test/tables/int_float.tbl", 2);
+    StorageManager::get().add_table("int_float", table);
+  }
+
+  void TearDown() override { StorageManager::get().reset(); }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(OperatorsGetTableTest, GetOutput) {
+  auto get_table = std::make_shared<GetTable>("int_float");
+  get_table->execute();
+
+  EXPECT_EQ(get_table->table_name(), "int_float");
+  EXPECT_EQ(get_table->get_output(), table);
+}
+
+TEST_F(OperatorsGetTableTest, UnknownTable) {
+  auto get_table = std::make_shared<GetTable>("unknown_table");
+  EXPECT_THROW(get_table->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,210 @@
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_hash.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto left_table = std::make_shared<Table>(7);
+    left_table->add_column("a", "int");
+    left_table->add_column("b", "string");
+    for (auto i = 0; i < 40; ++i) left_table->append({i % 13, "left" + std::to_string(i % 9)});
+    left_table->compress_chunk(ChunkID{1});
+
+    auto right_table = std::make_shared<Table>(5);
+    right_table->add_column("c", "float");
+    right_table->add_column("d", "int");
+    right_table->add_column("e", "string");
+    for (auto i = 0; i < 30; ++i) {
+      right_table->append({i * 0.5f, i % 17 - 2, "left" + std::to_string(i % 11)});
+    }
+
+    left = std::make_shared<TableWrapper>(left_table);
+    left->execute();
+    right = std::make_shared<TableWrapper>(right_table);
+    right->execute();
+  }
+
+  // computes the expected result of an equi-join with a nested loop over the values
+  std::shared_ptr<Table> _expected_join(const Table& left_table, const Table& right_table,
+                                        const std::pair<ColumnID, ColumnID>& column_ids) {
+    auto expected = std::make_shared<Table>();
+    for (const auto* table : {&left_table, &right_table}) {
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        expected->add_column(table->column_name(column_id), table->column_type(column_id));
+      }
+    }
+
+    const auto rows = [](const Table& table) {
+      auto result = std::vector<std::vector<AllTypeVariant>>{};
+      for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+        const auto& chunk = table.get_chunk(chunk_id);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+          auto& row = result.emplace_back();
+          for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+            row.emplace_back((*chunk.get_segment(column_id))[chunk_offset]);
+          }
+        }
+      }
+      return result;
+    };
+
+    for (const auto& left_row : rows(left_table)) {
+      for (const auto& right_row : rows(right_table)) {
+        if (left_row[column_ids.first] != right_row[column_ids.second]) continue;
+        auto row = left_row;
+        row.insert(row.end(), right_row.cbegin(), right_row.cend());
+        expected->append(row);
+      }
+    }
+    return expected;
+  }
+
+  std::shared_ptr<TableWrapper> left;
+  std::shared_ptr<TableWrapper> right;
+};
+
+TEST_F(OperatorsJoinHashTest, IntegerJoin) {
+  const auto column_ids = std::make_pair(ColumnID{0}, ColumnID{1});
+  auto join = std::make_shared<JoinHash>(left, right, column_ids, ScanType::OpEquals);
+  join->execute();
+
+  EXPECT_EQ(join->column_ids(), column_ids);
+  EXPECT_EQ(join->scan_type(), ScanType::OpEquals);
+  EXPECT_TABLE_EQ(join->get_output(), _expected_join(*left->get_output(), *right->get_output(), column_ids));
+  EXPECT_EQ(join->get_output()->column_name(ColumnID{4}), "e");
+}
+
+TEST_F(OperatorsJoinHashTest, StringJoin) {
+  const auto column_ids = std::make_pair(ColumnID{1}, ColumnID{2});
+  auto join = std::make_shared<JoinHash>(right, left, std::make_pair(column_ids.second, column_ids.first),
+                                         ScanType::OpEquals);
+  join->execute();
+
+  EXPECT_TABLE_EQ(join->get_output(),
+                  _expected_join(*right->get_output(), *left->get_output(), std::make_pair(ColumnID{2}, ColumnID{1})));
+}
+
+TEST_F(OperatorsJoinHashTest, ReferenceInputs) {
+  auto left_scan = std::make_shared<TableScan>(left, ColumnID{0}, ScanType::OpGreaterThan, 3);
+  left_scan->execute();
+  auto right_scan = std::make_shared<TableScan>(right, ColumnID{0}, ScanType::OpLessThan, 10.0f);
+  right_scan->execute();
+
+  const auto column_ids = std::make_pair(ColumnID{0}, ColumnID{1});
+  auto join = std::make_shared<JoinHash>(left_scan, right_scan, column_ids, ScanType::OpEquals);
+  join->execute();
+  EXPECT_TABLE_EQ(join->get_output(),
+                  _expected_join(*left_scan->get_output(), *right_scan->get_output(), column_ids));
+
+  // the output references the stored tables, not the scan results
+  const auto segment = join->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{2});
+  EXPECT_EQ(std::dynamic_pointer_cast<ReferenceSegment>(segment)->referenced_table(), right->get_output());
+}
+
+TEST_F(OperatorsJoinHashTest, EmptyResult) {
+  auto empty_scan = std::make_shared<TableScan>(left, ColumnID{0}, ScanType::OpLessThan, -100);
+  empty_scan->execute();
+
+  auto join = std::make_shared<JoinHash>(empty_scan, right, std::make_pair(ColumnID{0}, ColumnID{1}),
+                                         ScanType::OpEquals);
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 0u);
+  EXPECT_EQ(join->get_output()->column_count(), 5u);
+}
+
+TEST_F(OperatorsJoinHashTest, ManyPartitions) {
+  // large enough to be partitioned, with a skewed key
+  auto left_table = std::make_shared<Table>(10'000);
+  left_table->add_column("a", "long");
+  auto right_table = std::make_shared<Table>(3'000);
+  right_table->add_column("b", "long");
+
+  auto left_values = pmr_vector<int64_t>{};
+  for (auto i = int64_t{0}; i < 100'000; ++i) left_values.emplace_back(i % 1'000 == 0 ? 7 : i * 3);
+  left_table->append_columns({std::move(left_values)});
+  auto right_values = pmr_vector<int64_t>{};
+  for (auto i = int64_t{0}; i < 20'000; ++i) right_values.emplace_back(i * 2);
+  right_table->append_columns({std::move(right_values)});
+
+  auto left_wrapper = std::make_shared<TableWrapper>(left_table);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right_table);
+  right_wrapper->execute();
+
+  auto join = std::make_shared<JoinHash>(left_wrapper, right_wrapper, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                         ScanType::OpEquals);
+  join->execute();
+
+  // multiples of 6 below 40'000 (except multiples of 3'000, which are replaced by 7 in the left input)
+  const auto& output = *join->get_output();
+  EXPECT_EQ(output.row_count(), size_t{6'667 - 14});
+  const auto& chunk = output.get_chunk(ChunkID{0});
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); chunk_offset += 97) {
+    EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[chunk_offset], (*chunk.get_segment(ColumnID{1}))[chunk_offset]);
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, SkewedKeys) {
+  // most build rows share a single value, which must still be matched with all of its build rows
+  auto left_table = std::make_shared<Table>(1'000);
+  left_table->add_column("a", "int");
+  auto right_table = std::make_shared<Table>(1'000);
+  right_table->add_column("b", "int");
+
+  auto left_values = pmr_vector<int32_t>{};
+  for (auto i = 0; i < 5'000; ++i) left_values.emplace_back(i % 50 == 0 ? i : 42);
+  left_table->append_columns({std::move(left_values)});
+  auto right_values = pmr_vector<int32_t>{};
+  for (auto i = 0; i < 20'000; ++i) right_values.emplace_back(i % 1'000 == 0 ? 42 : i);
+  right_table->append_columns({std::move(right_values)});
+
+  auto left_wrapper = std::make_shared<TableWrapper>(left_table);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right_table);
+  right_wrapper->execute();
+
+  auto join = std::make_shared<JoinHash>(left_wrapper, right_wrapper, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                         ScanType::OpEquals);
+  join->execute();
+
+  // 21 rows of 42 on the right (20 multiples of 1'000 and 42 itself) match 4'900 rows each, and the multiples of 50 on
+  // the left match once, except for 0 and the multiples of 1'000
+  const auto& output = *join->get_output();
+  EXPECT_EQ(output.row_count(), size_t{21 * 4'900 + 95});
+
+  auto skewed_match_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto& chunk = output.get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      const auto left_value = (*chunk.get_segment(ColumnID{0}))[chunk_offset];
+      EXPECT_EQ(left_value, (*chunk.get_segment(ColumnID{1}))[chunk_offset]);
+      if (left_value == AllTypeVariant{42}) ++skewed_match_count;
+    }
+  }
+  EXPECT_EQ(skewed_match_count, size_t{21 * 4'900});
+}
+
+TEST_F(OperatorsJoinHashTest, InvalidJoins) {
+  EXPECT_THROW(JoinHash(left, right, std::make_pair(ColumnID{0}, ColumnID{1}), ScanType::OpLessThan),
+               std::exception);
+
+  auto type_mismatch = std::make_shared<JoinHash>(left, right, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                                  ScanType::OpEquals);
+  EXPECT_THROW(type_mismatch->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,199 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/join_sort_merge.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/type_comparison.hpp"
+
+namespace opossum {
+
+class OperatorsJoinSortMergeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto left_table = std::make_shared<Table>(7);
+    left_table->add_column("a", "int");
+    left_table->add_column("b", "string");
+    for (auto i = 0; i < 40; ++i) left_table->append({(i * 7) % 13, "value" + std::to_string(i % 9)});
+    left_table->compress_chunk(ChunkID{1});
+
+    auto right_table = std::make_shared<Table>(5);
+    right_table->add_column("c", "float");
+    right_table->add_column("d", "int");
+    right_table->add_column("e", "string");
+    for (auto i = 0; i < 30; ++i) {
+      right_table->append({i * 0.5f, i % 17 - 2, "value" + std::to_string(i % 11)});
+    }
+    right_table->compress_chunk(ChunkID{2});
+
+    left = std::make_shared<TableWrapper>(left_table);
+    left->execute();
+    right = std::make_shared<TableWrapper>(right_table);
+    right->execute();
+  }
+
+  // computes the expected result of a join with a nested loop over the values
+  std::shared_ptr<Table> _expected_join(const Table& left_table, const Table& right_table,
+                                        const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type) {
+    auto expected = std::make_shared<Table>();
+    for (const auto* table : {&left_table, &right_table}) {
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        expected->add_column(table->column_name(column_id), table->column_type(column_id));
+      }
+    }
+
+    const auto rows = [](const Table& table) {
+      auto result = std::vector<std::vector<AllTypeVariant>>{};
+      for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+        const auto& chunk = table.get_chunk(chunk_id);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+          auto& row = result.emplace_back();
+          for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+            row.emplace_back((*chunk.get_segment(column_id))[chunk_offset]);
+          }
+        }
+      }
+      return result;
+    };
+
+    with_comparator(scan_type, [&](auto comparator) {
+      for (const auto& left_row : rows(left_table)) {
+        for (const auto& right_row : rows(right_table)) {
+          if (!comparator(left_row[column_ids.first], right_row[column_ids.second])) continue;
+          auto row = left_row;
+          row.insert(row.end(), right_row.cbegin(), right_row.cend());
+          expected->append(row);
+        }
+      }
+    });
+    return expected;
+  }
+
+  void _check_all_scan_types(const std::shared_ptr<const AbstractOperator>& left_input,
+                             const std::shared_ptr<const AbstractOperator>& right_input,
+                             const std::pair<ColumnID, ColumnID>& column_ids) {
+    for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                 ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+      SCOPED_TRACE(static_cast<int>(scan_type));
+      auto join = std::make_shared<JoinSortMerge>(left_input, right_input, column_ids, scan_type);
+      join->execute();
+      EXPECT_EQ(join->scan_type(), scan_type);
+      EXPECT_TABLE_EQ(join->get_output(), _expected_join(*left_input->get_output(), *right_input->get_output(),
+                                                         column_ids, scan_type));
+    }
+  }
+
+  std::shared_ptr<TableWrapper> left;
+  std::shared_ptr<TableWrapper> right;
+};
+
+TEST_F(OperatorsJoinSortMergeTest, IntegerJoin) { _check_all_scan_types(left, right, {ColumnID{0}, ColumnID{1}}); }
+
+TEST_F(OperatorsJoinSortMergeTest, StringJoin) { _check_all_scan_types(left, right, {ColumnID{1}, ColumnID{2}}); }
+
+TEST_F(OperatorsJoinSortMergeTest, ReferenceInputs) {
+  auto left_scan = std::make_shared<TableScan>(left, ColumnID{0}, ScanType::OpGreaterThan, 3);
+  left_scan->execute();
+  auto right_scan = std::make_shared<TableScan>(right, ColumnID{0}, ScanType::OpLessThan, 10.0f);
+  right_scan->execute();
+
+  _check_all_scan_types(left_scan, right_scan, {ColumnID{0}, ColumnID{1}});
+}
+
+TEST_F(OperatorsJoinSortMergeTest, EmptyInput) {
+  auto empty_scan = std::make_shared<TableScan>(left, ColumnID{0}, ScanType::OpLessThan, -100);
+  empty_scan->execute();
+
+  auto join = std::make_shared<JoinSortMerge>(empty_scan, right, std::make_pair(ColumnID{0}, ColumnID{1}),
+                                              ScanType::OpNotEquals);
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 0u);
+  EXPECT_EQ(join->get_output()->column_count(), 5u);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, SortedInputs) {
+  // sorted timestamps in many chunks, so that the merge phase is split into several partitions
+  auto left_table = std::make_shared<Table>(1'000);
+  left_table->add_column("a", "long");
+  auto right_table = std::make_shared<Table>(3'000);
+  right_table->add_column("b", "long");
+
+  auto left_values = pmr_vector<int64_t>{};
+  for (auto i = int64_t{0}; i < 30'000; ++i) left_values.emplace_back(i * 2);
+  left_table->append_columns({std::move(left_values)});
+  auto right_values = pmr_vector<int64_t>{};
+  for (auto i = int64_t{0}; i < 20'000; ++i) right_values.emplace_back(i * 3);
+  right_table->append_columns({std::move(right_values)});
+
+  auto left_wrapper = std::make_shared<TableWrapper>(left_table);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right_table);
+  right_wrapper->execute();
+
+  const auto column_ids = std::make_pair(ColumnID{0}, ColumnID{0});
+  auto equi_join = std::make_shared<JoinSortMerge>(left_wrapper, right_wrapper, column_ids, ScanType::OpEquals);
+  equi_join->execute();
+  // multiples of 6 below 60'000
+  EXPECT_EQ(equi_join->get_output()->row_count(), size_t{10'000});
+
+  // a left value v is less than all right values except for the multiples of 3 in [0, v]
+  auto range_filter = std::make_shared<TableScan>(left_wrapper, ColumnID{0}, ScanType::OpLessThan, int64_t{30});
+  range_filter->execute();
+  auto range_join = std::make_shared<JoinSortMerge>(range_filter, right_wrapper, column_ids, ScanType::OpLessThan);
+  range_join->execute();
+  auto expected_count = size_t{0};
+  for (auto left_value = 0; left_value < 30; left_value += 2) expected_count += 20'000 - (left_value / 3 + 1);
+  EXPECT_EQ(range_join->get_output()->row_count(), expected_count);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, UnsortedInputs) {
+  // shuffled values with duplicates in many chunks, so that the merges of the sort phase are split into several pieces
+  auto left_table = std::make_shared<Table>(1'000);
+  left_table->add_column("a", "int");
+  auto right_table = std::make_shared<Table>(1'000);
+  right_table->add_column("b", "int");
+
+  auto left_values = pmr_vector<int32_t>{};
+  for (auto i = 0; i < 40'000; ++i) left_values.emplace_back(i * 7'919 % 5'000);
+  left_table->append_columns({std::move(left_values)});
+  auto right_values = pmr_vector<int32_t>{};
+  for (auto i = 0; i < 10'000; ++i) right_values.emplace_back(i * 3'181 % 5'000);
+  right_table->append_columns({std::move(right_values)});
+
+  auto left_wrapper = std::make_shared<TableWrapper>(left_table);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right_table);
+  right_wrapper->execute();
+
+  auto join = std::make_shared<JoinSortMerge>(left_wrapper, right_wrapper, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                              ScanType::OpEquals);
+  join->execute();
+
+  // each value appears 8 times on the left and twice on the right, and the output is ordered by value
+  const auto& output = *join->get_output();
+  EXPECT_EQ(output.row_count(), size_t{5'000 * 8 * 2});
+  auto previous_value = AllTypeVariant{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto& chunk = output.get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      const auto left_value = (*chunk.get_segment(ColumnID{0}))[chunk_offset];
+      EXPECT_EQ(left_value, (*chunk.get_segment(ColumnID{1}))[chunk_offset]);
+      EXPECT_LE(previous_value, left_value);
+      previous_value = left_value;
+    }
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, MismatchingColumnTypes) {
+  auto join = std::make_shared<JoinSortMerge>(left, right, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                              ScanType::OpLessThan);
+  EXPECT_THROW(join->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/sort.hpp"
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "float");
+    table->add_column("d", "long");
+    const auto strings = std::vector<std::string>{"", "a", "ab", "abc", "b", "ba", "B", "zzz"};
+    for (auto i = 0; i < 45; ++i) {
+      table->append({(i * 7) % 5 - 2, strings[(i * 3) % strings.size()], (i % 9 - 4) * 1.5f,
+                     int64_t{(i * 13) % 17} * 1'000'000'000'000 - 8'000'000'000'000});
+    }
+    table->compress_chunk(ChunkID{1});
+    table->compress_chunk(ChunkID{3});
+
+    table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+  }
+
+  // sorts the rows of the table with std::stable_sort on AllTypeVariants
+  std::shared_ptr<Table> _expected_sort(const Table& table, const std::vector<SortColumnDefinition>& sort_columns) {
+    auto rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        auto& row = rows.emplace_back();
+        for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+          row.emplace_back((*chunk.get_segment(column_id))[chunk_offset]);
+        }
+      }
+    }
+
+    std::stable_sort(rows.begin(), rows.end(), [&](const auto& lhs, const auto& rhs) {
+      for (const auto& sort_column : sort_columns) {
+        const auto& left_value = lhs[sort_column.column_id];
+        const auto& right_value = rhs[sort_column.column_id];
+        if (left_value == right_value) continue;
+        return sort_column.order == SortOrder::Ascending ? left_value < right_value : right_value < left_value;
+      }
+      return false;
+    });
+
+    auto expected = std::make_shared<Table>();
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      expected->add_column(table.column_name(column_id), table.column_type(column_id));
+    }
+    for (const auto& row : rows) expected->append(row);
+    return expected;
+  }
+
+  void _check_sort(const std::shared_ptr<const AbstractOperator>& in,
+                   const std::vector<SortColumnDefinition>& sort_columns) {
+    const auto expected = _expected_sort(*in->get_output(), sort_columns);
+    for (const auto output_mode : {SortOutputMode::References, SortOutputMode::Materialized}) {
+      auto sort = std::make_shared<Sort>(in, sort_columns, output_mode);
+      sort->execute();
+      EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+    }
+  }
+
+  std::shared_ptr<TableWrapper> table_wrapper;
+};
+
+TEST_F(OperatorsSortTest, SingleColumn) {
+  for (auto column_id = ColumnID{0}; column_id < 4; ++column_id) {
+    SCOPED_TRACE(column_id.t);
+    _check_sort(table_wrapper, {{column_id, SortOrder::Ascending}});
+    _check_sort(table_wrapper, {{column_id, SortOrder::Descending}});
+  }
+}
+
+TEST_F(OperatorsSortTest, MultipleColumns) {
+  // equal rows keep their order of the input, which the expected result checks as well
+  _check_sort(table_wrapper, {{ColumnID{0}, SortOrder::Ascending}, {ColumnID{1}, SortOrder::Descending}});
+  _check_sort(table_wrapper, {{ColumnID{1}, SortOrder::Ascending}, {ColumnID{2}, SortOrder::Descending},
+                              {ColumnID{0}, SortOrder::Ascending}});
+  _check_sort(table_wrapper, {{ColumnID{3}, SortOrder::Descending}, {ColumnID{0}, SortOrder::Descending}});
+}
+
+TEST_F(OperatorsSortTest, ReferenceInput) {
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 0);
+  scan->execute();
+  _check_sort(scan, {{ColumnID{2}, SortOrder::Descending}, {ColumnID{1}, SortOrder::Ascending}});
+
+  auto sort = std::make_shared<Sort>(scan, std::vector<SortColumnDefinition>{{ColumnID{1}, SortOrder::Ascending}});
+  sort->execute();
+  EXPECT_EQ(sort->sort_columns().size(), 1u);
+  EXPECT_EQ(sort->output_mode(), SortOutputMode::References);
+  const auto segment = sort->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  EXPECT_EQ(std::dynamic_pointer_cast<ReferenceSegment>(segment)->referenced_table(), table_wrapper->get_output());
+}
+
+TEST_F(OperatorsSortTest, MaterializedOutput) {
+  const auto sort_columns = std::vector<SortColumnDefinition>{{ColumnID{3}, SortOrder::Ascending}};
+  auto sort = std::make_shared<Sort>(table_wrapper, sort_columns, SortOutputMode::Materialized);
+  sort->execute();
+
+  const auto& output = *sort->get_output();
+  EXPECT_EQ(output.max_chunk_size(), 10u);
+  EXPECT_EQ(output.chunk_count(), 5u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<std::string>>(
+      output.get_chunk(ChunkID{1}).get_segment(ColumnID{1})));
+}
+
+TEST_F(OperatorsSortTest, LongStrings) {
+  // strings that only differ after the prefix in the keys, including a string of exactly the prefix size
+  auto table = std::make_shared<Table>(6);
+  table->add_column("a", "string");
+  table->add_column("b", "int");
+  const auto prefix = std::string(Sort::STRING_PREFIX_SIZE, 'x');
+  const auto strings = std::vector<std::string>{prefix + "b", prefix, prefix + "a", prefix + "ab", "x", prefix + "a"};
+  for (auto i = 0; i < 30; ++i) table->append({strings[(i * 5) % strings.size()], i % 4});
+  table->compress_chunk(ChunkID{2});
+
+  auto wrapper = std::make_shared<TableWrapper>(table);
+  wrapper->execute();
+  _check_sort(wrapper, {{ColumnID{0}, SortOrder::Ascending}, {ColumnID{1}, SortOrder::Descending}});
+  _check_sort(wrapper, {{ColumnID{0}, SortOrder::Descending}, {ColumnID{1}, SortOrder::Ascending}});
+  _check_sort(wrapper, {{ColumnID{1}, SortOrder::Ascending}, {ColumnID{0}, SortOrder::Descending}});
+}
+
+TEST_F(OperatorsSortTest, ManyChunks) {
+  // enough rows for the merge to be split into several parts, with many duplicate keys at the splitters
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", "int");
+  table->add_column("b", "long");
+  auto a_values = pmr_vector<int32_t>{};
+  auto b_values = pmr_vector<int64_t>{};
+  for (auto i = 0; i < 30'000; ++i) {
+    a_values.emplace_back(i * 7'919 % 100);
+    b_values.emplace_back(i);
+  }
+  table->append_columns({std::move(a_values), std::move(b_values)});
+
+  auto wrapper = std::make_shared<TableWrapper>(table);
+  wrapper->execute();
+  _check_sort(wrapper, {{ColumnID{0}, SortOrder::Descending}});
+}
+
+TEST_F(OperatorsSortTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+  auto sort = std::make_shared<Sort>(scan, std::vector<SortColumnDefinition>{{ColumnID{1}, SortOrder::Descending}});
+  sort->execute();
+  EXPECT_EQ(sort->get_output()->row_count(), 0u);
+  EXPECT_EQ(sort->get_output()->column_count(), 4u);
+}
+
+TEST_F(OperatorsSortTest, InvalidSortColumns) {
+  EXPECT_THROW(Sort(table_wrapper, {}), std::exception);
+
+  const auto sort_columns = std::vector<SortColumnDefinition>{{ColumnID{4}, SortOrder::Ascending}};
+  auto sort = std::make_shared<Sort>(table_wrapper, sort_columns);
+  EXPECT_THROW(sort->execute(), std::exception);
+}
+
+}  // namespace opossum
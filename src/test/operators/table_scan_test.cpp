@@ -0,0 +1,206 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/chunk_encoder.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/index/group_key/group_key_index.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/type_cast.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    table_wrapper->execute();
+
+    // chunks of 10 rows, the last one is incomplete
+    table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
+    table->add_column("c", "string");
+    table->add_column("d", "long");
+  }
+
+  void _fill_table() {
+    for (auto i = 0; i < 95; ++i) {
+      table->append({i / 5, i * 0.5f, "value" + std::to_string(i % 30), int64_t{i * 7 % 50}});
+    }
+  }
+
+  // compares the result of all scan types against evaluating the predicate row by row
+  template <typename T>
+  void _check_all_scan_types(const std::shared_ptr<const Table>& input, const ColumnID column_id,
+                             const std::vector<T>& search_values) {
+    auto wrapper = std::make_shared<TableWrapper>(input);
+    wrapper->execute();
+
+    for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                 ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+      for (const auto& search_value : search_values) {
+        auto expected = PosList{};
+        for (auto chunk_id = ChunkID{0}; chunk_id < input->chunk_count(); ++chunk_id) {
+          const auto& segment = *input->get_chunk(chunk_id).get_segment(column_id);
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+            const auto value = type_cast<T>(segment[chunk_offset]);
+            const auto matches = (scan_type == ScanType::OpEquals && value == search_value) ||
+                                 (scan_type == ScanType::OpNotEquals && value != search_value) ||
+                                 (scan_type == ScanType::OpLessThan && value < search_value) ||
+                                 (scan_type == ScanType::OpLessThanEquals && value <= search_value) ||
+                                 (scan_type == ScanType::OpGreaterThan && value > search_value) ||
+                                 (scan_type == ScanType::OpGreaterThanEquals && value >= search_value);
+            if (matches) expected.emplace_back(RowID{chunk_id, chunk_offset});
+          }
+        }
+
+        auto scan = std::make_shared<TableScan>(wrapper, column_id, scan_type, search_value);
+        scan->execute();
+        EXPECT_TRUE(*scan->pos_list() == expected)
+            << "column " << column_id << ", scan type " << static_cast<int>(scan_type) << ", value " << search_value;
+        EXPECT_EQ(scan->get_output()->row_count(), expected.size());
+      }
+    }
+  }
+
+  void _check_all_columns(const std::shared_ptr<const Table>& input) {
+    _check_all_scan_types<int32_t>(input, ColumnID{0}, {-1, 0, 7, 13, 18, 19});
+    _check_all_scan_types<float>(input, ColumnID{1}, {-1.0f, 10.5f, 10.75f, 47.0f});
+    _check_all_scan_types<std::string>(input, ColumnID{2}, {"", "value1", "value15", "value29", "value3", "x"});
+    _check_all_scan_types<int64_t>(input, ColumnID{3}, {0, 21, 49, 50});
+
+    // search values of other types are not rounded down, e.g., `a < 3.5` selects 3
+    _check_all_scan_types<double>(input, ColumnID{0}, {-1e20, -0.5, 3.5, 18.5, 1e20});
+    _check_all_scan_types<double>(input, ColumnID{1}, {-1e300, 10.1, 10.5, 1e300});
+    _check_all_scan_types<double>(input, ColumnID{3}, {-3.25, 20.5, 49.0});
+  }
+
+  std::shared_ptr<TableWrapper> table_wrapper;
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(OperatorsTableScanTest, ScanOnLoadedTable) {
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan->execute();
+
+  const auto expected = load_table("src/test/tables/int_float_filtered2.tbl", 2);
+  EXPECT_TABLE_EQ(scan->get_output(), expected);
+  EXPECT_EQ(scan->column_id(), ColumnID{0});
+  EXPECT_EQ(scan->scan_type(), ScanType::OpGreaterThanEquals);
+  EXPECT_EQ(scan->search_value(), AllTypeVariant{1234});
+}
+
+TEST_F(OperatorsTableScanTest, ChainedScans) {
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan_1->execute();
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
+  scan_2->execute();
+
+  const auto expected = load_table("src/test/tables/int_float_filtered.tbl", 2);
+  EXPECT_TABLE_EQ(scan_2->get_output(), expected);
+}
+
+TEST_F(OperatorsTableScanTest, OutputReferencesInput) {
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan_1->execute();
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 458.0);
+  scan_2->execute();
+
+  const auto input_table = table_wrapper->get_output();
+  const auto& output_chunk = scan_2->get_output()->get_chunk(ChunkID{0});
+  const auto segment_a = std::dynamic_pointer_cast<ReferenceSegment>(output_chunk.get_segment(ColumnID{0}));
+  const auto segment_b = std::dynamic_pointer_cast<ReferenceSegment>(output_chunk.get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment_a && segment_b);
+
+  // the chained scan references the original table, and both columns share one position list
+  EXPECT_EQ(segment_a->referenced_table(), input_table);
+  EXPECT_EQ(segment_b->referenced_column_id(), ColumnID{1});
+  EXPECT_EQ(segment_a->pos_list(), segment_b->pos_list());
+  EXPECT_EQ(*segment_a->pos_list(), (PosList{RowID{ChunkID{1}, 0}}));
+
+  // the positions of scan_2 refer to its input, i.e., the output of scan_1
+  EXPECT_EQ(*scan_2->pos_list(), (PosList{RowID{ChunkID{1}, 0}}));
+}
+
+TEST_F(OperatorsTableScanTest, EmptyResult) {
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90'000);
+  scan->execute();
+
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(scan->get_output()->column_count(), 2u);
+  EXPECT_TRUE(scan->pos_list()->empty());
+}
+
+TEST_F(OperatorsTableScanTest, UnencodedSegments) {
+  table->set_background_encoding(false);
+  _fill_table();
+  _check_all_columns(table);
+}
+
+TEST_F(OperatorsTableScanTest, EncodedSegments) {
+  // run-length for a, dictionary for b and c, frame-of-reference for d, with statistics for pruning
+  _fill_table();
+  table->wait_for_background_encoding();
+  // chunks this small are always smaller as dictionaries, so frame-of-reference is chosen explicitly
+  for (auto chunk_id = ChunkID{0}; chunk_id + 1 < table->chunk_count(); ++chunk_id) {
+    auto& chunk = table->get_chunk(chunk_id);
+    chunk.replace_segment(ColumnID{3}, ChunkEncoder::encode_segment(chunk.get_segment(ColumnID{3}), "long",
+                                                                    EncodingType::FrameOfReference));
+  }
+  EXPECT_EQ(ChunkEncoder::get_encoding_type(table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}), "int"),
+            EncodingType::RunLength);
+  EXPECT_EQ(ChunkEncoder::get_encoding_type(table->get_chunk(ChunkID{0}).get_segment(ColumnID{3}), "long"),
+            EncodingType::FrameOfReference);
+
+  _check_all_columns(table);
+}
+
+TEST_F(OperatorsTableScanTest, BitPackedDictionarySegments) {
+  table->set_background_encoding(false);
+  _fill_table();
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    auto& chunk = table->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      resolve_data_type(table->column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        chunk.replace_segment(column_id, std::make_shared<DictionarySegment<ColumnDataType>>(
+                                             chunk.get_segment(column_id), AttributeVectorEncoding::BitPacked));
+      });
+    }
+  }
+
+  _check_all_columns(table);
+}
+
+TEST_F(OperatorsTableScanTest, IndexedSegments) {
+  _fill_table();
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->compress_chunk(chunk_id);
+    table->get_chunk(chunk_id).create_index<GroupKeyIndex>({ColumnID{0}});
+    table->get_chunk(chunk_id).create_index<GroupKeyIndex>({ColumnID{2}});
+  }
+
+  _check_all_columns(table);
+}
+
+TEST_F(OperatorsTableScanTest, SearchValueIsConvertedToColumnType) {
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, int64_t{123});
+  scan->execute();
+  EXPECT_EQ(*scan->pos_list(), (PosList{RowID{ChunkID{0}, 1}}));
+}
+
+TEST_F(OperatorsTableScanTest, InvalidColumn) {
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{2}, ScanType::OpEquals, 1);
+  EXPECT_THROW(scan->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,22 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsTableWrapperTest : public BaseTest {};
+
+TEST_F(OperatorsTableWrapperTest, WrapsTable) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  EXPECT_EQ(table_wrapper->get_output(), nullptr);
+
+  table_wrapper->execute();
+  EXPECT_EQ(table_wrapper->get_output(), table);
+}
+
+}  // namespace opossum
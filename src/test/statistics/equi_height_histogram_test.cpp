@@ -0,0 +1,70 @@
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/equi_height_histogram.hpp"
+
+namespace opossum {
+
+class StatisticsEquiHeightHistogramTest : public BaseTest {};
+
+TEST_F(StatisticsEquiHeightHistogramTest, Bins) {
+  const auto values = std::vector<int32_t>{1, 2, 2, 2, 2, 3, 4, 5, 6, 7};
+  const auto histogram = EquiHeightHistogram<int32_t>{values, 3, 10, 7};
+
+  // equal values are kept in one bin, so the first bin is higher than the others
+  ASSERT_EQ(histogram.bin_count(), 3u);
+  EXPECT_EQ(histogram.bin_minimum(0), 1);
+  EXPECT_EQ(histogram.bin_maximum(0), 2);
+  EXPECT_DOUBLE_EQ(histogram.bin_height(0), 5.0);
+  EXPECT_DOUBLE_EQ(histogram.bin_distinct_count(0), 2.0);
+  EXPECT_EQ(histogram.bin_minimum(1), 3);
+  EXPECT_EQ(histogram.bin_maximum(1), 6);
+  EXPECT_EQ(histogram.bin_minimum(2), 7);
+  EXPECT_DOUBLE_EQ(histogram.total_count(), 10.0);
+}
+
+TEST_F(StatisticsEquiHeightHistogramTest, EstimateCardinality) {
+  auto values = std::vector<int32_t>{};
+  for (auto value = 0; value < 1'000; ++value) values.push_back(value);
+
+  // the values are a 10% sample of a column with 10'000 rows and 1'000 distinct values
+  const auto histogram = EquiHeightHistogram<int32_t>{values, 10, 10'000, 1'000};
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, 500), 10.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, -1), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, 1'000), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpNotEquals, 500), 9'990.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpLessThan, 250), 2'500.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpLessThanEquals, 250), 2'510.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpGreaterThan, 250), 7'490.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpGreaterThanEquals, 250), 7'500.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpLessThan, 0), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpLessThan, 5'000), 10'000.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpGreaterThan, 999), 0.0);
+}
+
+TEST_F(StatisticsEquiHeightHistogramTest, Strings) {
+  const auto values = std::vector<std::string>{"aa", "ab", "ba", "bb", "ca", "cb", "da", "db"};
+  const auto histogram = EquiHeightHistogram<std::string>{values, 2, 8, 8};
+
+  ASSERT_EQ(histogram.bin_count(), 2u);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, "ba"), 1.0);
+  // between the bins
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, "bc"), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpEquals, "e"), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpLessThan, "ca"), 4.0);
+
+  const auto less_than_b = histogram.estimate_cardinality(ScanType::OpLessThan, "b");
+  EXPECT_GT(less_than_b, 1.0);
+  EXPECT_LT(less_than_b, 3.0);
+}
+
+TEST_F(StatisticsEquiHeightHistogramTest, Empty) {
+  const auto histogram = EquiHeightHistogram<float>{{}, 10, 0, 0};
+  EXPECT_EQ(histogram.bin_count(), 0u);
+  EXPECT_DOUBLE_EQ(histogram.estimate_cardinality(ScanType::OpGreaterThan, 1.0f), 0.0);
+}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#include <functional>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/hyper_log_log.hpp"
+
+namespace opossum {
+
+class StatisticsHyperLogLogTest : public BaseTest {};
+
+TEST_F(StatisticsHyperLogLogTest, Estimate) {
+  auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.estimate(), 0u);
+
+  for (auto repetition = 0; repetition < 3; ++repetition) {
+    for (auto value = 0; value < 100; ++value) sketch.insert(std::hash<int>{}(value));
+  }
+  EXPECT_NEAR(sketch.estimate(), 100, 3);
+
+  for (auto value = 0; value < 100'000; ++value) sketch.insert(std::hash<std::string>{}("v" + std::to_string(value)));
+  EXPECT_NEAR(sketch.estimate(), 100'100, 100'100 * 0.05);
+}
+
+TEST_F(StatisticsHyperLogLogTest, Merge) {
+  auto first_sketch = HyperLogLog{};
+  auto second_sketch = HyperLogLog{};
+  for (auto value = 0; value < 20'000; ++value) first_sketch.insert(std::hash<int>{}(value));
+  for (auto value = 10'000; value < 30'000; ++value) second_sketch.insert(std::hash<int>{}(value));
+
+  first_sketch.merge(second_sketch);
+  EXPECT_NEAR(first_sketch.estimate(), 30'000, 30'000 * 0.05);
+}
+
+}  // namespace opossum
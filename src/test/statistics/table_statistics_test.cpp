@@ -0,0 +1,94 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/statistics/column_statistics.hpp"
+#include "../lib/statistics/table_statistics.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class StatisticsTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(1'000);
+    table->add_column("id", "int");
+    table->add_column("name", "string");
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(StatisticsTableStatisticsTest, UpdatedWhenChunksAreComplete) {
+  const auto statistics = table->table_statistics();
+  EXPECT_EQ(statistics->row_count(), 0u);
+  EXPECT_DOUBLE_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 5), 1.0);
+
+  for (auto row = 0; row < 999; ++row) table->append({row, "name" + std::to_string(row % 10)});
+  EXPECT_EQ(table->table_statistics()->row_count(), 0u);
+
+  table->append({999, "name9"});
+  const auto first_chunk_statistics = table->table_statistics();
+  EXPECT_EQ(first_chunk_statistics->row_count(), 1'000u);
+  EXPECT_EQ(first_chunk_statistics->chunk_count(), ChunkID{1});
+  // statistics that were handed out before are not modified
+  EXPECT_EQ(statistics->row_count(), 0u);
+
+  auto ids = pmr_vector<int32_t>{};
+  auto names = pmr_vector<std::string>{};
+  for (auto row = 1'000; row < 5'500; ++row) {
+    ids.push_back(row);
+    names.push_back("name" + std::to_string(row % 10));
+  }
+  table->append_columns({std::move(ids), std::move(names)});
+  EXPECT_EQ(table->table_statistics()->row_count(), 5'000u);
+  EXPECT_EQ(table->table_statistics()->chunk_count(), ChunkID{5});
+  EXPECT_EQ(table->table_statistics()->column_statistics(ColumnID{0}).row_count(), 5'000u);
+  EXPECT_EQ(first_chunk_statistics->row_count(), 1'000u);
+}
+
+TEST_F(StatisticsTableStatisticsTest, Estimates) {
+  for (auto row = 0; row < 20'000; ++row) table->append({row % 5'000, "name" + std::to_string(row % 10)});
+  table->wait_for_background_encoding();
+
+  const auto statistics = table->table_statistics();
+  EXPECT_EQ(statistics->row_count(), 20'000u);
+
+  const auto& id_statistics = statistics->column_statistics(ColumnID{0});
+  EXPECT_EQ(id_statistics.row_count(), 20'000u);
+  EXPECT_NEAR(id_statistics.distinct_count(), 5'000, 250);
+  EXPECT_DOUBLE_EQ(id_statistics.null_fraction(), 0.0);
+  EXPECT_NEAR(statistics->column_statistics(ColumnID{1}).distinct_count(), 10, 1);
+
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 1'000), 0.2, 0.03);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 4'000), 0.2, 0.03);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 1'234), 0.0002, 0.0001);
+  EXPECT_DOUBLE_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 10'000), 0.0);
+  // numeric search values of other types are converted
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 1'000.0), 0.2, 0.03);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, int64_t{1'000}), 0.2, 0.03);
+  // values that would change when converted are not truncated, e.g., `= 2.5` is not estimated as `= 2`
+  EXPECT_DOUBLE_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 1'234.5), 1.0);
+  EXPECT_DOUBLE_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, int64_t{1} << 40), 1.0);
+  EXPECT_DOUBLE_EQ(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, "1000"), 1.0);
+
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpEquals, "name3"), 0.1, 0.02);
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{1}, ScanType::OpNotEquals, "name3"), 0.9, 0.02);
+
+  const auto& typed_statistics = static_cast<const ColumnStatistics<int32_t>&>(id_statistics);
+  ASSERT_NE(typed_statistics.histogram(), nullptr);
+  EXPECT_EQ(typed_statistics.histogram()->bin_count(), ColumnStatistics<int32_t>::DEFAULT_BIN_COUNT);
+}
+
+TEST_F(StatisticsTableStatisticsTest, LoadedTable) {
+  const auto loaded_table = load_table_parallel("src/test/tables/all_data_types.tbl", 2);
+  EXPECT_EQ(loaded_table->table_statistics()->row_count(), loaded_table->row_count());
+  EXPECT_EQ(loaded_table->table_statistics()->column_statistics(ColumnID{4}).row_count(), loaded_table->row_count());
+}
+
+}  // namespace opossum
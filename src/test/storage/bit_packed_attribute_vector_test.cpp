@@ -0,0 +1,87 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageBitPackedAttributeVectorTest : public BaseTest {};
+
+TEST_F(StorageBitPackedAttributeVectorTest, BitWidth) {
+  EXPECT_EQ(BitPackedAttributeVector(1, 10).bit_width(), 1u);
+  EXPECT_EQ(BitPackedAttributeVector(2, 10).bit_width(), 1u);
+  EXPECT_EQ(BitPackedAttributeVector(20, 10).bit_width(), 5u);
+  EXPECT_EQ(BitPackedAttributeVector(20, 10).width(), 1u);
+  EXPECT_EQ(BitPackedAttributeVector(257, 10).bit_width(), 9u);
+  EXPECT_EQ(BitPackedAttributeVector(257, 10).width(), 2u);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, SetAndGet) {
+  // 5 and 13 bits do not divide 32, so values span word boundaries
+  for (const auto dictionary_size : {size_t{20}, size_t{5'000}, size_t{1} << 31}) {
+    BitPackedAttributeVector attribute_vector{dictionary_size, 300};
+    EXPECT_EQ(attribute_vector.size(), 300u);
+    EXPECT_EQ(attribute_vector.block_count(), 3u);
+
+    for (auto i = size_t{0}; i < 300; ++i) {
+      attribute_vector.set(i, ValueID{static_cast<uint32_t>((i * 7) % dictionary_size)});
+    }
+    // overwriting must not affect neighbours
+    attribute_vector.set(42, ValueID{static_cast<uint32_t>(dictionary_size - 1)});
+
+    for (auto i = size_t{0}; i < 300; ++i) {
+      const auto expected = i == 42 ? dictionary_size - 1 : (i * 7) % dictionary_size;
+      EXPECT_EQ(attribute_vector.get(i), ValueID{static_cast<uint32_t>(expected)});
+    }
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, DecodeBlock) {
+  BitPackedAttributeVector attribute_vector{20, 200};
+  for (auto i = size_t{0}; i < 200; ++i) attribute_vector.set(i, ValueID{static_cast<uint32_t>(i % 20)});
+
+  BitPackedAttributeVector::Block block;
+  attribute_vector.decode_block(1, block);
+  for (auto i = size_t{0}; i < 72; ++i) {
+    EXPECT_EQ(block[i], ValueID{static_cast<uint32_t>((128 + i) % 20)});
+  }
+  for (auto i = size_t{72}; i < BitPackedAttributeVector::BLOCK_SIZE; ++i) {
+    EXPECT_EQ(block[i], ValueID{0});
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, Unpack) {
+  BitPackedAttributeVector attribute_vector{5'000, 600};
+  for (auto i = size_t{0}; i < 600; ++i) attribute_vector.set(i, ValueID{static_cast<uint32_t>(i * 13 % 5'000)});
+
+  // ranges within a block, across blocks, covering whole blocks, and up to the end
+  for (const auto& [begin, count] : std::vector<std::pair<size_t, size_t>>{{3, 10}, {100, 60}, {128, 256}, {5, 595}}) {
+    auto output = std::vector<ValueID>(count);
+    attribute_vector.unpack(begin, count, output.data());
+    for (auto i = size_t{0}; i < count; ++i) {
+      EXPECT_EQ(output[i], attribute_vector.get(begin + i));
+    }
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, DictionarySegment) {
+  auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  for (auto i = 0; i < 1000; ++i) value_segment->append(std::to_string(i % 20));
+
+  const auto dictionary_segment =
+      std::make_shared<DictionarySegment<std::string>>(value_segment, AttributeVectorEncoding::BitPacked);
+  const auto attribute_vector =
+      std::dynamic_pointer_cast<const BitPackedAttributeVector>(dictionary_segment->attribute_vector());
+  ASSERT_NE(attribute_vector, nullptr);
+  EXPECT_EQ(attribute_vector->bit_width(), 5u);
+  EXPECT_EQ(dictionary_segment->get(999), "19");
+}
+
+}  // namespace opossum
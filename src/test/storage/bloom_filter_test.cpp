@@ -0,0 +1,37 @@
+#include <functional>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bloom_filter.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  auto bloom_filter = BloomFilter{1'000};
+  for (auto value = 0; value < 1'000; ++value) bloom_filter.insert(std::hash<int>{}(value * 3));
+  for (auto value = 0; value < 1'000; ++value) EXPECT_TRUE(bloom_filter.may_contain(std::hash<int>{}(value * 3)));
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  auto bloom_filter = BloomFilter{10'000};
+  for (auto value = 0; value < 10'000; ++value) bloom_filter.insert(std::hash<int>{}(value));
+
+  auto false_positives = 0;
+  for (auto value = 10'000; value < 110'000; ++value) {
+    if (bloom_filter.may_contain(std::hash<int>{}(value))) ++false_positives;
+  }
+  // about 1% are expected
+  EXPECT_LT(false_positives, 2'000);
+  EXPECT_GE(bloom_filter.estimate_memory_usage(), 10'000 * BloomFilter::BITS_PER_VALUE / 8);
+}
+
+TEST_F(StorageBloomFilterTest, Empty) {
+  const auto bloom_filter = BloomFilter{0};
+  EXPECT_FALSE(bloom_filter.may_contain(0));
+  EXPECT_FALSE(bloom_filter.may_contain(17));
+}
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/chunk_encoder.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/segment_statistics.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageChunkEncoderTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto i = 0; i < 100; ++i) {
+      sorted_int_segment->append(i / 10);
+      int_segment->append(i * 7 % 100);
+      string_segment->append("value" + std::to_string(i * 7 % 100));
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> sorted_int_segment = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<int32_t>> int_segment = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<std::string>> string_segment = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageChunkEncoderTest, ChooseEncoding) {
+  EXPECT_EQ(ChunkEncoder::choose_encoding(sorted_int_segment, "int"), EncodingType::RunLength);
+  EXPECT_EQ(ChunkEncoder::choose_encoding(int_segment, "int"), EncodingType::FrameOfReference);
+  EXPECT_EQ(ChunkEncoder::choose_encoding(string_segment, "string"), EncodingType::Dictionary);
+
+  auto wide_segment = std::make_shared<ValueSegment<int64_t>>();
+  wide_segment->append(int64_t{0});
+  wide_segment->append(int64_t{1} << 40);
+  EXPECT_EQ(ChunkEncoder::choose_encoding(wide_segment, "long"), EncodingType::Dictionary);
+
+  // four distinct values with a wide range need 20 bits per row as frame-of-reference, but only one byte as dictionary
+  auto few_values_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto i = 0; i < 1'000; ++i) few_values_segment->append(i * 7 % 4 * 300'000);
+  EXPECT_EQ(ChunkEncoder::choose_encoding(few_values_segment, "int"), EncodingType::Dictionary);
+}
+
+TEST_F(StorageChunkEncoderTest, EncodeSegment) {
+  const auto segment = ChunkEncoder::encode_segment(int_segment, "int", EncodingType::RunLength);
+  EXPECT_NE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(segment), nullptr);
+  EXPECT_EQ((*segment)[3], AllTypeVariant{21});
+
+  EXPECT_THROW(ChunkEncoder::encode_segment(string_segment, "string", EncodingType::FrameOfReference), std::exception);
+}
+
+TEST_F(StorageChunkEncoderTest, EncodeChunk) {
+  auto chunk = std::make_shared<Chunk>();
+  chunk->add_segment(sorted_int_segment);
+  chunk->add_segment(int_segment);
+  chunk->add_segment(string_segment);
+
+  ChunkEncoder::encode_chunk(chunk, {"int", "int", "string"});
+  EXPECT_NE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(chunk->get_segment(ColumnID{0})), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(chunk->get_segment(ColumnID{1})), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk->get_segment(ColumnID{2})), nullptr);
+  EXPECT_EQ(chunk->size(), 100u);
+  EXPECT_EQ((*chunk->get_segment(ColumnID{2}))[3], AllTypeVariant{"value21"});
+}
+
+TEST_F(StorageChunkEncoderTest, MemoryUsage) {
+  auto chunk = std::make_shared<Chunk>();
+  chunk->add_segment(sorted_int_segment);
+  chunk->add_segment(string_segment);
+
+  EXPECT_GE(sorted_int_segment->estimate_memory_usage(), 100 * sizeof(int32_t));
+  const auto unencoded_bytes = chunk->estimate_memory_usage();
+  EXPECT_GE(unencoded_bytes, sorted_int_segment->estimate_memory_usage() + string_segment->estimate_memory_usage());
+
+  ChunkEncoder::encode_chunk(chunk, {"int", "string"});
+  EXPECT_LT(chunk->get_segment(ColumnID{0})->estimate_memory_usage(), sorted_int_segment->estimate_memory_usage());
+  // all strings are distinct, so a dictionary of std::strings is larger than the contiguous character buffer
+  EXPECT_GT(chunk->get_segment(ColumnID{1})->estimate_memory_usage(), string_segment->estimate_memory_usage());
+  EXPECT_EQ(chunk->estimate_memory_usage(), unencoded_bytes - sorted_int_segment->estimate_memory_usage() -
+                                                string_segment->estimate_memory_usage() +
+                                                chunk->get_segment(ColumnID{0})->estimate_memory_usage() +
+                                                chunk->get_segment(ColumnID{1})->estimate_memory_usage() +
+                                                chunk->get_segment_statistics(ColumnID{0})->estimate_memory_usage() +
+                                                chunk->get_segment_statistics(ColumnID{1})->estimate_memory_usage());
+
+  EXPECT_EQ(ChunkEncoder::get_encoding_type(chunk->get_segment(ColumnID{0}), "int"), EncodingType::RunLength);
+  EXPECT_EQ(ChunkEncoder::get_encoding_type(string_segment, "string"), EncodingType::Unencoded);
+}
+
+TEST_F(StorageChunkEncoderTest, BackgroundEncoding) {
+  Table table{10};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+
+  for (auto i = 0; i < 25; ++i) table.append({i / 5, std::to_string(i)});
+  table.wait_for_background_encoding();
+
+  EXPECT_EQ(table.chunk_count(), 3u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    EXPECT_NE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(chunk.get_segment(ColumnID{0})), nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk.get_segment(ColumnID{1})), nullptr);
+  }
+
+  // the last chunk is still being written to and remains unencoded
+  const auto& last_chunk = table.get_chunk(ChunkID{2});
+  EXPECT_NE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(last_chunk.get_segment(ColumnID{0})), nullptr);
+
+  EXPECT_EQ((*table.get_chunk(ChunkID{1}).get_segment(ColumnID{1}))[4], AllTypeVariant{"14"});
+  EXPECT_EQ(table.row_count(), 25u);
+}
+
+}  // namespace opossum
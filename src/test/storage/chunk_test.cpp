@@ -1,4 +1,5 @@
 #include <memory>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -6,64 +7,89 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/base_segment.hpp"
 #include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/index/group_key/group_key_index.hpp"
 #include "../lib/types.hpp"
 
 namespace opossum {
 
-// class StorageChunkTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     int_value_segment = make_shared_by_data_type<BaseSegment, ValueSegment>("int");
-//     int_value_segment->append(4);
-//     int_value_segment->append(6);
-//     int_value_segment->append(3);
-
-//     string_value_segment = make_shared_by_data_type<BaseSegment, ValueSegment>("string");
-//     string_value_segment->append("Hello,");
-//     string_value_segment->append("world");
-//     string_value_segment->append("!");
-//   }
-
-//   Chunk c;
-//   std::shared_ptr<BaseSegment> int_value_segment = nullptr;
-//   std::shared_ptr<BaseSegment> string_value_segment = nullptr;
-// };
-
-// TEST_F(StorageChunkTest, AddSegmentToChunk) {
-//   EXPECT_EQ(c.size(), 0u);
-//   c.add_segment(int_value_segment);
-//   c.add_segment(string_value_segment);
-//   EXPECT_EQ(c.size(), 3u);
-// }
-
-// TEST_F(StorageChunkTest, AddValuesToChunk) {
-//   c.add_segment(int_value_segment);
-//   c.add_segment(string_value_segment);
-//   c.append({2, "two"});
-//   EXPECT_EQ(c.size(), 4u);
-
-//   if (IS_DEBUG) {
-//     EXPECT_THROW(c.append({}), std::exception);
-//     EXPECT_THROW(c.append({4, "val", 3}), std::exception);
-//     EXPECT_EQ(c.size(), 4u);
-//   }
-// }
-
-// TEST_F(StorageChunkTest, RetrieveSegment) {
-//   c.add_segment(int_value_segment);
-//   c.add_segment(string_value_segment);
-//   c.append({2, "two"});
-
-//   auto base_segment = c.get_segment(ColumnID{0});
-//   EXPECT_EQ(base_segment->size(), 4u);
-// }
-
-// TEST_F(StorageChunkTest, UnknownSegmentType) {
-//   // Exception will only be thrown in debug builds
-//   if (IS_DEBUG) {
-//     auto wrapper = []() { make_shared_by_data_type<BaseSegment, ValueSegment>("weird_type"); };
-//     EXPECT_THROW(wrapper(), std::logic_error);
-//   }
-// }
+class StorageChunkTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    int_value_segment = make_shared_by_data_type<BaseSegment, ValueSegment>("int");
+    int_value_segment->append(4);
+    int_value_segment->append(6);
+    int_value_segment->append(3);
+
+    string_value_segment = make_shared_by_data_type<BaseSegment, ValueSegment>("string");
+    string_value_segment->append("Hello,");
+    string_value_segment->append("world");
+    string_value_segment->append("!");
+  }
+
+  Chunk c;
+  std::shared_ptr<BaseSegment> int_value_segment = nullptr;
+  std::shared_ptr<BaseSegment> string_value_segment = nullptr;
+};
+
+TEST_F(StorageChunkTest, AddSegmentToChunk) {
+  EXPECT_EQ(c.size(), 0u);
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  EXPECT_EQ(c.size(), 3u);
+}
+
+TEST_F(StorageChunkTest, AddValuesToChunk) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  c.append({2, "two"});
+  EXPECT_EQ(c.size(), 4u);
+
+  if (IS_DEBUG) {
+    EXPECT_THROW(c.append({}), std::exception);
+    EXPECT_THROW(c.append({4, "val", 3}), std::exception);
+    EXPECT_EQ(c.size(), 4u);
+  }
+}
+
+TEST_F(StorageChunkTest, RetrieveSegment) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  c.append({2, "two"});
+
+  auto base_segment = c.get_segment(ColumnID{0});
+  EXPECT_EQ(base_segment->size(), 4u);
+}
+
+TEST_F(StorageChunkTest, UnknownSegmentType) {
+  // Exception will only be thrown in debug builds
+  if (IS_DEBUG) {
+    auto wrapper = []() { make_shared_by_data_type<BaseSegment, ValueSegment>("weird_type"); };
+    EXPECT_THROW(wrapper(), std::logic_error);
+  }
+}
+
+TEST_F(StorageChunkTest, Indexes) {
+  const auto dictionary_segment = std::make_shared<DictionarySegment<int32_t>>(int_value_segment);
+  c.add_segment(dictionary_segment);
+  c.add_segment(string_value_segment);
+  const auto bytes_without_index = c.estimate_memory_usage();
+
+  const auto index = c.create_index<GroupKeyIndex>({ColumnID{0}});
+  EXPECT_EQ(c.get_indexes(std::vector<ColumnID>{ColumnID{0}}), std::vector<std::shared_ptr<BaseIndex>>{index});
+  EXPECT_EQ(c.get_indexes({dictionary_segment}), std::vector<std::shared_ptr<BaseIndex>>{index});
+  EXPECT_TRUE(c.get_indexes(std::vector<ColumnID>{ColumnID{1}}).empty());
+  EXPECT_EQ(c.estimate_memory_usage(), bytes_without_index + index->estimate_memory_usage());
+  EXPECT_THROW(c.create_index<GroupKeyIndex>({ColumnID{0}, ColumnID{1}}), std::exception);
+
+  // the index dictionary-encodes a copy of other segments, the chunk keeps its segment
+  const auto string_index = c.create_index<GroupKeyIndex>({ColumnID{1}});
+  EXPECT_EQ(c.get_indexes(std::vector<ColumnID>{ColumnID{1}}), std::vector<std::shared_ptr<BaseIndex>>{string_index});
+  EXPECT_EQ(c.get_segment(ColumnID{1}), string_value_segment);
+  c.remove_index(string_index);
+
+  c.remove_index(index);
+  EXPECT_TRUE(c.get_indexes(std::vector<ColumnID>{ColumnID{0}}).empty());
+}
 
 }  // namespace opossum
@@ -0,0 +1,103 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/base_segment.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/fitted_attribute_vector.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageDictionarySegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> vc_int = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  vc_str->append("Steve");
+  vc_str->append("Hasso");
+  vc_str->append("Bill");
+
+  auto col = make_shared_by_data_type<BaseSegment, DictionarySegment>("string", vc_str);
+  auto dict_col = std::dynamic_pointer_cast<DictionarySegment<std::string>>(col);
+
+  // Test attribute_vector size
+  EXPECT_EQ(dict_col->size(), 6u);
+
+  // Test dictionary size (uniqueness)
+  EXPECT_EQ(dict_col->unique_values_count(), 4u);
+
+  // Test sorting
+  auto dict = dict_col->dictionary();
+  EXPECT_EQ((*dict)[0], "Alexander");
+  EXPECT_EQ((*dict)[1], "Bill");
+  EXPECT_EQ((*dict)[2], "Hasso");
+  EXPECT_EQ((*dict)[3], "Steve");
+
+  // Test decoding
+  EXPECT_EQ(dict_col->get(0), "Bill");
+  EXPECT_EQ(dict_col->get(1), "Steve");
+  EXPECT_EQ(dict_col->get(4), "Hasso");
+  EXPECT_EQ((*dict_col)[2], AllTypeVariant{"Alexander"});
+}
+
+TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
+  for (int i = 0; i <= 10; i += 2) vc_int->append(i);
+  auto col = make_shared_by_data_type<BaseSegment, DictionarySegment>("int", vc_int);
+  auto dict_col = std::dynamic_pointer_cast<DictionarySegment<int>>(col);
+
+  EXPECT_EQ(dict_col->lower_bound(4), (ValueID)2);
+  EXPECT_EQ(dict_col->upper_bound(4), (ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(AllTypeVariant{4}), (ValueID)2);
+  EXPECT_EQ(dict_col->upper_bound(AllTypeVariant{4}), (ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(5), (ValueID)3);
+  EXPECT_EQ(dict_col->upper_bound(5), (ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(15), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->upper_bound(15), INVALID_VALUE_ID);
+}
+
+TEST_F(StorageDictionarySegmentTest, AttributeVectorWidth) {
+  for (int i = 0; i < 256; ++i) vc_int->append(i);
+  auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+  EXPECT_EQ(dict_col->attribute_vector()->width(), 1u);
+
+  vc_int->append(256);
+  dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+  EXPECT_EQ(dict_col->attribute_vector()->width(), 2u);
+  EXPECT_EQ(dict_col->get(256), 256);
+
+  EXPECT_EQ(make_fitted_attribute_vector(70'000, 1)->width(), 4u);
+}
+
+TEST_F(StorageDictionarySegmentTest, UnpackFittedAttributeVector) {
+  for (int i = 0; i < 300; ++i) vc_int->append(i % 270);
+  const auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+  const auto& attribute_vector = *dict_col->attribute_vector();
+  EXPECT_EQ(attribute_vector.width(), 2u);
+
+  auto output = std::vector<ValueID>(20);
+  attribute_vector.unpack(260, 20, output.data());
+  for (auto i = size_t{0}; i < 20; ++i) {
+    EXPECT_EQ(output[i], attribute_vector.get(260 + i));
+  }
+}
+
+TEST_F(StorageDictionarySegmentTest, Immutable) {
+  vc_int->append(1);
+  auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int);
+  EXPECT_THROW(dict_col->append(2), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegmentInt) {
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (const auto value : {-5, 10, 3, 0, 1'000}) value_segment->append(value);
+
+  auto for_segment = std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment);
+  EXPECT_EQ(for_segment->size(), 5u);
+  EXPECT_EQ(*for_segment->block_minima(), std::vector<int32_t>{-5});
+  // the largest offset is 1'005, which needs 10 bits
+  EXPECT_EQ((*for_segment->block_offsets())[0].bit_width(), 10u);
+
+  EXPECT_EQ(for_segment->get(0), -5);
+  EXPECT_EQ(for_segment->get(4), 1'000);
+  EXPECT_EQ((*for_segment)[2], AllTypeVariant{3});
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, MultipleBlocksLong) {
+  // a monotonically increasing timestamp: wide values, narrow range per block
+  const auto base = int64_t{1'570'000'000'000};
+  const auto block_size = FrameOfReferenceSegment<int64_t>::BLOCK_SIZE;
+  const auto row_count = block_size * 2 + 17;
+
+  auto value_segment = std::make_shared<ValueSegment<int64_t>>();
+  for (auto i = size_t{0}; i < row_count; ++i) value_segment->append(base + static_cast<int64_t>(i) * 3);
+
+  auto for_segment = std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment);
+  EXPECT_EQ(for_segment->block_minima()->size(), 3u);
+  EXPECT_EQ((*for_segment->block_minima())[1], base + static_cast<int64_t>(block_size) * 3);
+  EXPECT_EQ((*for_segment->block_offsets())[0].bit_width(), 13u);
+
+  for (auto i = size_t{0}; i < row_count; ++i) {
+    EXPECT_EQ(for_segment->get(i), base + static_cast<int64_t>(i) * 3);
+  }
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, BitWidthPerBlock) {
+  const auto block_size = FrameOfReferenceSegment<int32_t>::BLOCK_SIZE;
+
+  // the values of the first block fit into 2 bits, a single outlier widens only the second block
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto i = size_t{0}; i < block_size * 2; ++i) {
+    value_segment->append(i == block_size + 5 ? 1'000'000 : static_cast<int32_t>(i % 4));
+  }
+
+  auto for_segment = std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment);
+  const auto& block_offsets = *for_segment->block_offsets();
+  ASSERT_EQ(block_offsets.size(), 2u);
+  EXPECT_EQ(block_offsets[0].bit_width(), 2u);
+  EXPECT_EQ(block_offsets[1].bit_width(), 20u);
+  EXPECT_EQ(for_segment->get(block_size + 3), 3);
+  EXPECT_EQ(for_segment->get(block_size + 5), 1'000'000);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, ExtremeValues) {
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  value_segment->append(std::numeric_limits<int32_t>::min());
+  value_segment->append(std::numeric_limits<int32_t>::min() + 1);
+
+  auto for_segment = std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment);
+  EXPECT_EQ(for_segment->get(1), std::numeric_limits<int32_t>::min() + 1);
+  EXPECT_THROW(for_segment->append(1), std::exception);
+
+  // a block may span exactly 2^32 - 1
+  auto widest_segment = std::make_shared<ValueSegment<int32_t>>();
+  widest_segment->append(std::numeric_limits<int32_t>::min());
+  widest_segment->append(std::numeric_limits<int32_t>::max());
+  auto widest_for_segment = std::make_shared<FrameOfReferenceSegment<int32_t>>(widest_segment);
+  EXPECT_EQ((*widest_for_segment->block_offsets())[0].bit_width(), 32u);
+  EXPECT_EQ(widest_for_segment->get(1), std::numeric_limits<int32_t>::max());
+
+  auto wide_segment = std::make_shared<ValueSegment<int64_t>>();
+  wide_segment->append(int64_t{0});
+  wide_segment->append(std::numeric_limits<int64_t>::max());
+  EXPECT_THROW(std::make_shared<FrameOfReferenceSegment<int64_t>>(wide_segment), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../../lib/storage/base_segment.hpp"
+#include "../../../lib/storage/frame_of_reference_segment.hpp"
+#include "../../../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "../../../lib/storage/run_length_segment.hpp"
+#include "../../../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class AdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    string_segment = std::make_shared<ValueSegment<std::string>>();
+    for (const auto* value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox", "app"}) {
+      string_segment->append(value);
+    }
+    index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>{string_segment});
+  }
+
+  std::vector<ChunkOffset> _positions(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  // compares all lookups in [min, max] against a scan of the values
+  template <typename T>
+  void _check_against_scan(const BaseIndex& art_index, const std::vector<T>& values, const T min, const T max) {
+    for (auto lower = min; lower <= max; ++lower) {
+      auto expected = std::vector<ChunkOffset>{};
+      for (auto upper = lower; upper <= max && upper <= lower + 3; ++upper) {
+        expected.clear();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+          if (values[chunk_offset] >= lower && values[chunk_offset] <= upper) expected.emplace_back(chunk_offset);
+        }
+        auto positions = _positions(art_index.lower_bound({lower}), art_index.upper_bound({upper}));
+        std::sort(positions.begin(), positions.end());
+        ASSERT_EQ(positions, expected) << "range [" << lower << ", " << upper << "]";
+      }
+    }
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> string_segment;
+  std::shared_ptr<AdaptiveRadixTreeIndex> index;
+};
+
+TEST_F(AdaptiveRadixTreeIndexTest, IndexPostings) {
+  // sorted: app, apple, charlie, delta, frank, hotel, inbox
+  EXPECT_EQ(_positions(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{8, 4, 5, 6, 1, 3, 2, 0, 7}));
+  EXPECT_EQ(index->type(), SegmentIndexType::AdaptiveRadixTree);
+  EXPECT_TRUE(index->is_index_for({string_segment}));
+  EXPECT_GE(index->estimate_memory_usage(), 9 * sizeof(ChunkOffset));
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, StringLookups) {
+  EXPECT_EQ(_positions(index->lower_bound({"delta"}), index->upper_bound({"delta"})), (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(_positions(index->lower_bound({"app"}), index->upper_bound({"app"})), (std::vector<ChunkOffset>{8}));
+  EXPECT_EQ(_positions(index->lower_bound({"apple"}), index->upper_bound({"apple"})), (std::vector<ChunkOffset>{4}));
+  EXPECT_EQ(_positions(index->lower_bound({"charlie"}), index->upper_bound({"frank"})),
+            (std::vector<ChunkOffset>{5, 6, 1, 3, 2}));
+
+  // values that are not indexed
+  EXPECT_EQ(index->lower_bound({"ap"}), index->cbegin());
+  EXPECT_EQ(index->lower_bound({"appl"}), index->cbegin() + 1);
+  EXPECT_EQ(index->lower_bound({"apples"}), index->cbegin() + 2);
+  EXPECT_EQ(index->lower_bound({"bravo"}), index->upper_bound({"bravo"}));
+  EXPECT_EQ(index->lower_bound({"zulu"}), index->cend());
+  EXPECT_EQ(index->upper_bound({"inbox"}), index->cend());
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, IntegerLookups) {
+  // enough distinct values to create nodes of all sizes, including negative values
+  auto values = std::vector<int32_t>{};
+  auto random_engine = std::mt19937{17};
+  auto distribution = std::uniform_int_distribution<int32_t>{-300, 300};
+  auto int_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto i = 0; i < 2'000; ++i) {
+    values.emplace_back(i % 3 == 0 ? distribution(random_engine) / 20 : distribution(random_engine));
+    int_segment->append(values.back());
+  }
+
+  const auto int_index = AdaptiveRadixTreeIndex{{int_segment}};
+  _check_against_scan<int32_t>(int_index, values, -302, 302);
+
+  EXPECT_EQ(int_index.lower_bound({std::numeric_limits<int32_t>::min()}), int_index.cbegin());
+  EXPECT_EQ(int_index.upper_bound({std::numeric_limits<int32_t>::max()}), int_index.cend());
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, EncodedSegments) {
+  auto values = std::vector<int64_t>{};
+  auto value_segment = std::make_shared<ValueSegment<int64_t>>();
+  for (auto i = int64_t{0}; i < 1'000; ++i) {
+    values.emplace_back((i / 10) * (i % 2 == 0 ? 1 : -1) * 1'007);
+    value_segment->append(values.back());
+  }
+
+  const auto run_length_index = AdaptiveRadixTreeIndex{{std::make_shared<RunLengthSegment<int64_t>>(value_segment)}};
+  const auto frame_of_reference_index =
+      AdaptiveRadixTreeIndex{{std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment)}};
+
+  for (const auto* art_index : {&run_length_index, &frame_of_reference_index}) {
+    auto positions = _positions(art_index->lower_bound({int64_t{-5'035}}), art_index->upper_bound({0}));
+    EXPECT_EQ(positions.size(), 35u);
+    EXPECT_TRUE(std::all_of(positions.cbegin(), positions.cend(),
+                            [&](const auto position) { return values[position] <= 0; }));
+
+    // the search value is converted to the column type
+    EXPECT_EQ(_positions(art_index->lower_bound({int32_t{0}}), art_index->upper_bound({int32_t{0}})).size(), 10u);
+  }
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, FloatingPointLookups) {
+  auto double_segment = std::make_shared<ValueSegment<double>>();
+  for (const auto value : {2.5, -0.0, -1.5, 0.0, -100.25, 1e10, -1e-10}) double_segment->append(value);
+  const auto double_index = AdaptiveRadixTreeIndex{{double_segment}};
+
+  EXPECT_EQ(_positions(double_index.cbegin(), double_index.cend()), (std::vector<ChunkOffset>{4, 2, 6, 1, 3, 0, 5}));
+  EXPECT_EQ(_positions(double_index.lower_bound({0.0}), double_index.upper_bound({0.0})),
+            (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(_positions(double_index.lower_bound({-2.0}), double_index.upper_bound({3.0})),
+            (std::vector<ChunkOffset>{2, 6, 1, 3, 0}));
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, SearchValuesAreNotRoundedDown) {
+  auto int_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (const auto value : {3, 1, 4, 2, 3}) int_segment->append(value);
+  const auto int_index = AdaptiveRadixTreeIndex{{int_segment}};
+
+  // 2.5 lies between 2 and 3, so both of its bounds point to the first 3
+  EXPECT_EQ(int_index.lower_bound({2.5}), int_index.cbegin() + 2);
+  EXPECT_EQ(int_index.upper_bound({2.5}), int_index.cbegin() + 2);
+  EXPECT_EQ(_positions(int_index.lower_bound({-2.5}), int_index.upper_bound({3.5})),
+            (std::vector<ChunkOffset>{1, 3, 0, 4}));
+  EXPECT_EQ(int_index.lower_bound({-1e20}), int_index.cbegin());
+  EXPECT_EQ(int_index.lower_bound({1e20}), int_index.cend());
+  EXPECT_EQ(int_index.upper_bound({int64_t{1} << 40}), int_index.cend());
+
+  auto float_segment = std::make_shared<ValueSegment<float>>();
+  for (const auto value : {0.1f, 0.7f}) float_segment->append(value);
+  const auto float_index = AdaptiveRadixTreeIndex{{float_segment}};
+
+  // the float closest to 0.1 is greater than the double 0.1, the float closest to 0.7 is less than the double 0.7
+  EXPECT_EQ(float_index.lower_bound({0.1}), float_index.cbegin());
+  EXPECT_EQ(float_index.upper_bound({0.1}), float_index.cbegin());
+  EXPECT_EQ(float_index.lower_bound({0.7}), float_index.cend());
+  EXPECT_EQ(float_index.lower_bound({double{0.1f}}), float_index.cbegin());
+  EXPECT_EQ(float_index.upper_bound({double{0.1f}}), float_index.cbegin() + 1);
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, EmptySegment) {
+  const auto empty_index = AdaptiveRadixTreeIndex{{std::make_shared<ValueSegment<int32_t>>()}};
+  EXPECT_EQ(empty_index.lower_bound({5}), empty_index.cend());
+  EXPECT_EQ(empty_index.cbegin(), empty_index.cend());
+
+  EXPECT_THROW(AdaptiveRadixTreeIndex({}), std::logic_error);
+}
+
+}  // namespace opossum
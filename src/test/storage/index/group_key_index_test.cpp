@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../../lib/storage/base_segment.hpp"
+#include "../../../lib/storage/dictionary_segment.hpp"
+#include "../../../lib/storage/frame_of_reference_segment.hpp"
+#include "../../../lib/storage/index/group_key/group_key_index.hpp"
+#include "../../../lib/storage/run_length_segment.hpp"
+#include "../../../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class GroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto value_segment = std::make_shared<ValueSegment<std::string>>();
+    for (const auto* value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"}) {
+      value_segment->append(value);
+    }
+    dictionary_segment = std::make_shared<DictionarySegment<std::string>>(value_segment);
+    index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const BaseSegment>>{dictionary_segment});
+  }
+
+  std::vector<ChunkOffset> _positions(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<DictionarySegment<std::string>> dictionary_segment;
+  std::shared_ptr<GroupKeyIndex> index;
+};
+
+TEST_F(GroupKeyIndexTest, IndexOffsetsAndPostings) {
+  // dictionary: apple, charlie, delta, frank, hotel, inbox
+  EXPECT_EQ(_positions(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{4, 5, 6, 1, 3, 2, 0, 7}));
+  EXPECT_EQ(index->type(), SegmentIndexType::GroupKey);
+  EXPECT_TRUE(index->is_index_for({dictionary_segment}));
+  EXPECT_GE(index->estimate_memory_usage(), 15 * sizeof(ChunkOffset));
+}
+
+TEST_F(GroupKeyIndexTest, PointAndRangeLookups) {
+  EXPECT_EQ(_positions(index->lower_bound({"delta"}), index->upper_bound({"delta"})), (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(_positions(index->lower_bound({"charlie"}), index->upper_bound({"frank"})),
+            (std::vector<ChunkOffset>{5, 6, 1, 3, 2}));
+
+  // values that are not in the dictionary
+  EXPECT_EQ(index->lower_bound({"bravo"}), index->upper_bound({"bravo"}));
+  EXPECT_EQ(_positions(index->lower_bound({"bravo"}), index->upper_bound({"bravo"})), std::vector<ChunkOffset>{});
+  EXPECT_EQ(index->lower_bound({"aaa"}), index->cbegin());
+  EXPECT_EQ(index->lower_bound({"zulu"}), index->cend());
+  EXPECT_EQ(index->upper_bound({"inbox"}), index->cend());
+}
+
+TEST_F(GroupKeyIndexTest, BitPackedSegment) {
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto i = 0; i < 1'000; ++i) value_segment->append(i % 7);
+  const auto segment = std::make_shared<DictionarySegment<int32_t>>(value_segment, AttributeVectorEncoding::BitPacked);
+  const auto int_index = GroupKeyIndex{{segment}};
+
+  const auto positions = _positions(int_index.lower_bound({3}), int_index.upper_bound({3}));
+  EXPECT_EQ(positions.size(), 143u);
+  EXPECT_TRUE(std::is_sorted(positions.cbegin(), positions.cend()));
+  EXPECT_TRUE(std::all_of(positions.cbegin(), positions.cend(), [](const auto position) { return position % 7 == 3; }));
+}
+
+TEST_F(GroupKeyIndexTest, OtherEncodings) {
+  auto value_segment = std::make_shared<ValueSegment<int64_t>>();
+  for (auto i = int64_t{0}; i < 100; ++i) value_segment->append(i / 10);
+  const auto run_length_segment = std::make_shared<RunLengthSegment<int64_t>>(value_segment);
+  const auto frame_of_reference_segment = std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment);
+
+  // the segments are dictionary-encoded into a copy owned by the index
+  for (const auto& segment : std::vector<std::shared_ptr<const BaseSegment>>{
+           value_segment, run_length_segment, frame_of_reference_segment}) {
+    const auto segment_index = GroupKeyIndex{{segment}};
+    EXPECT_TRUE(segment_index.is_index_for({segment}));
+    EXPECT_EQ(_positions(segment_index.lower_bound({int64_t{3}}), segment_index.upper_bound({int64_t{4}})).size(), 20u);
+    EXPECT_GE(segment_index.estimate_memory_usage(), 100 * sizeof(ChunkOffset) + 10 * sizeof(int64_t));
+  }
+}
+
+TEST_F(GroupKeyIndexTest, SingleSegment) {
+  EXPECT_THROW(GroupKeyIndex({}), std::logic_error);
+  EXPECT_THROW(GroupKeyIndex({dictionary_segment, dictionary_segment}), std::logic_error);
+}
+
+}  // namespace opossum
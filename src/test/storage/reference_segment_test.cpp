@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk_encoder.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/segment_iterate.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageReferenceSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // four chunks: run-length/dictionary, frame-of-reference/dictionary, dictionary/run-length, unencoded
+    table = std::make_shared<Table>(8);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto first_row = 0; first_row < 30; first_row += 8) {
+      _add_chunk(first_row, first_row < 24);
+    }
+
+    pos_list = std::make_shared<PosList>(PosList{{ChunkID{3}, 5}, {ChunkID{0}, 2}, {ChunkID{0}, 7}, {ChunkID{1}, 0},
+                                                 {ChunkID{2}, 3}, {ChunkID{2}, 1}, {ChunkID{1}, 6}, {ChunkID{3}, 0}});
+  }
+
+  void _add_chunk(const int first_row, const bool encode) {
+    auto int_segment = std::make_shared<ValueSegment<int32_t>>();
+    auto string_segment = std::make_shared<ValueSegment<std::string>>();
+    for (auto i = first_row; i < std::min(first_row + 8, 30); ++i) {
+      int_segment->append(i < 8 ? 1 : i * 3);
+      string_segment->append("value" + std::to_string(i >= 16 && i < 24 ? 0 : i));
+    }
+
+    auto chunk = std::make_shared<Chunk>();
+    chunk->add_segment(int_segment);
+    chunk->add_segment(string_segment);
+    if (encode) ChunkEncoder::encode_chunk(chunk, {"int", "string"});
+    if (first_row == 8) {
+      // chunks this small are always smaller as dictionaries, so frame-of-reference is chosen explicitly
+      chunk->replace_segment(ColumnID{0}, ChunkEncoder::encode_segment(chunk->get_segment(ColumnID{0}), "int",
+                                                                       EncodingType::FrameOfReference));
+    }
+    table->emplace_chunk(std::move(*chunk));
+  }
+
+  std::shared_ptr<Table> table;
+  std::shared_ptr<PosList> pos_list;
+};
+
+TEST_F(StorageReferenceSegmentTest, Accessors) {
+  const auto segment = ReferenceSegment{table, ColumnID{1}, pos_list};
+
+  EXPECT_EQ(segment.size(), 8u);
+  EXPECT_EQ(segment.referenced_table(), table);
+  EXPECT_EQ(segment.referenced_column_id(), ColumnID{1});
+  EXPECT_EQ(segment.pos_list(), pos_list);
+  EXPECT_EQ(segment[0], AllTypeVariant{"value29"});
+  EXPECT_EQ(segment[4], AllTypeVariant{"value0"});
+  EXPECT_GE(segment.estimate_memory_usage(), 8 * sizeof(RowID));
+}
+
+TEST_F(StorageReferenceSegmentTest, Immutable) {
+  auto segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+  EXPECT_THROW(segment.append(1), std::exception);
+}
+
+TEST_F(StorageReferenceSegmentTest, InvalidColumn) {
+  EXPECT_THROW(ReferenceSegment(table, ColumnID{2}, pos_list), std::exception);
+}
+
+TEST_F(StorageReferenceSegmentTest, SegmentIterate) {
+  EXPECT_EQ(ChunkEncoder::get_encoding_type(table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}), "int"),
+            EncodingType::RunLength);
+  EXPECT_EQ(ChunkEncoder::get_encoding_type(table->get_chunk(ChunkID{1}).get_segment(ColumnID{0}), "int"),
+            EncodingType::FrameOfReference);
+  EXPECT_EQ(ChunkEncoder::get_encoding_type(table->get_chunk(ChunkID{2}).get_segment(ColumnID{1}), "string"),
+            EncodingType::RunLength);
+
+  auto int_values = std::vector<int32_t>{};
+  segment_iterate<int32_t>(ReferenceSegment{table, ColumnID{0}, pos_list},
+                           [&](const ChunkOffset chunk_offset, const int32_t value) {
+                             EXPECT_EQ(chunk_offset, int_values.size());
+                             int_values.emplace_back(value);
+                           });
+  EXPECT_EQ(int_values, (std::vector<int32_t>{87, 1, 1, 24, 57, 51, 42, 72}));
+
+  auto string_values = std::vector<std::string>{};
+  segment_iterate<std::string>(ReferenceSegment{table, ColumnID{1}, pos_list},
+                               [&](const ChunkOffset, const std::string_view value) {
+                                 string_values.emplace_back(value);
+                               });
+  EXPECT_EQ(string_values, (std::vector<std::string>{"value29", "value2", "value7", "value8", "value0", "value0",
+                                                     "value14", "value24"}));
+}
+
+}  // namespace opossum
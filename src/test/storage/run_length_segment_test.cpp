@@ -0,0 +1,65 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto value : {3, 3, 3, 1, 1, 7, 3, 3}) vc_int->append(value);
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> vc_int = std::make_shared<ValueSegment<int32_t>>();
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegment) {
+  auto segment = make_shared_by_data_type<BaseSegment, RunLengthSegment>("int", vc_int);
+  auto rle_segment = std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(segment);
+
+  EXPECT_EQ(rle_segment->size(), 8u);
+  EXPECT_EQ(rle_segment->run_count(), 4u);
+  EXPECT_EQ(*rle_segment->values(), (std::vector<int32_t>{3, 1, 7, 3}));
+  EXPECT_EQ(*rle_segment->end_positions(), (std::vector<ChunkOffset>{2, 4, 5, 7}));
+}
+
+TEST_F(StorageRunLengthSegmentTest, Get) {
+  auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(vc_int);
+
+  const auto& values = vc_int->values();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    EXPECT_EQ(rle_segment->get(chunk_offset), values[chunk_offset]);
+  }
+  EXPECT_EQ((*rle_segment)[5], AllTypeVariant{7});
+}
+
+TEST_F(StorageRunLengthSegmentTest, ForEachMatch) {
+  auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(vc_int);
+
+  auto predicate_calls = 0;
+  std::vector<ChunkOffset> matches;
+  rle_segment->for_each_match(
+      [&](const int32_t value) {
+        ++predicate_calls;
+        return value == 3;
+      },
+      [&](const ChunkOffset chunk_offset) { matches.push_back(chunk_offset); });
+
+  EXPECT_EQ(predicate_calls, 4);
+  EXPECT_EQ(matches, (std::vector<ChunkOffset>{0, 1, 2, 6, 7}));
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptyAndImmutable) {
+  auto rle_segment = std::make_shared<RunLengthSegment<std::string>>(std::make_shared<ValueSegment<std::string>>());
+  EXPECT_EQ(rle_segment->size(), 0u);
+  EXPECT_THROW(rle_segment->append("a"), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/chunk_encoder.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/segment_iterate.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentIterateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // more than one bit-packed block and more than one frame-of-reference block
+    for (auto i = 0; i < 5'000; ++i) {
+      int_segment->append(i / 3 - 500);
+      string_segment->append("s" + std::to_string(i % 17));
+    }
+  }
+
+  template <typename T>
+  std::vector<T> _collect(const std::shared_ptr<BaseSegment>& segment) {
+    std::vector<T> values;
+    segment_iterate<T>(*segment, [&](const ChunkOffset chunk_offset, const auto& value) {
+      EXPECT_EQ(chunk_offset, values.size());
+      values.emplace_back(value);
+    });
+    return values;
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> int_segment = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<std::string>> string_segment = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageSegmentIterateTest, AllEncodingsInt) {
+  const auto expected = std::vector<int32_t>(int_segment->values().cbegin(), int_segment->values().cend());
+  EXPECT_EQ(_collect<int32_t>(int_segment), expected);
+
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FrameOfReference}) {
+    const auto encoded_segment = ChunkEncoder::encode_segment(int_segment, "int", encoding_type);
+    EXPECT_EQ(_collect<int32_t>(encoded_segment), expected);
+  }
+}
+
+TEST_F(StorageSegmentIterateTest, AllEncodingsString) {
+  std::vector<std::string> expected;
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < string_segment->size(); ++chunk_offset) {
+    expected.emplace_back(string_segment->get(chunk_offset));
+  }
+  EXPECT_EQ(_collect<std::string>(string_segment), expected);
+
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::RunLength}) {
+    const auto encoded_segment = ChunkEncoder::encode_segment(string_segment, "string", encoding_type);
+    EXPECT_EQ(_collect<std::string>(encoded_segment), expected);
+  }
+
+  const auto bit_packed_segment =
+      std::make_shared<DictionarySegment<std::string>>(string_segment, AttributeVectorEncoding::BitPacked);
+  EXPECT_EQ(_collect<std::string>(bit_packed_segment), expected);
+}
+
+TEST_F(StorageSegmentIterateTest, ResolveDataType) {
+  auto count = size_t{0};
+  segment_iterate(*string_segment, "string", [&](const ChunkOffset, const auto& value) {
+    using ValueType = std::decay_t<decltype(value)>;
+    EXPECT_TRUE((std::is_same_v<ValueType, std::string_view>));
+    ++count;
+  });
+  EXPECT_EQ(count, 5'000u);
+}
+
+}  // namespace opossum
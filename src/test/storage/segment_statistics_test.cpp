@@ -0,0 +1,162 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/chunk_encoder.hpp"
+#include "../lib/storage/segment_statistics.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto i = 0; i < 100; ++i) {
+      int_segment->append(10 + i / 4);
+      string_segment->append("v" + std::to_string(i % 7));
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> int_segment = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<std::string>> string_segment = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageSegmentStatisticsTest, AllEncodings) {
+  for (const auto encoding_type : {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
+                                   EncodingType::FrameOfReference}) {
+    const auto segment = ChunkEncoder::encode_segment(int_segment, "int", encoding_type);
+    const auto statistics = SegmentStatistics<int32_t>{*segment};
+    EXPECT_EQ(statistics.min(), 10);
+    EXPECT_EQ(statistics.max(), 34);
+    EXPECT_EQ(statistics.row_count(), 100u);
+    EXPECT_EQ(statistics.null_count(), 0u);
+    EXPECT_EQ(statistics.distinct_count(), 25u);
+  }
+
+  for (const auto encoding_type : {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength}) {
+    const auto segment = ChunkEncoder::encode_segment(string_segment, "string", encoding_type);
+    const auto statistics = create_segment_statistics(*segment, "string");
+    const auto& string_statistics = static_cast<const SegmentStatistics<std::string>&>(*statistics);
+    EXPECT_EQ(string_statistics.min(), "v0");
+    EXPECT_EQ(string_statistics.max(), "v6");
+    EXPECT_EQ(string_statistics.distinct_count(), 7u);
+  }
+}
+
+TEST_F(StorageSegmentStatisticsTest, CanPrune) {
+  const auto statistics = SegmentStatistics<int32_t>{10, 34, 100, 25};
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 9));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, 10));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, 34));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 35));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpNotEquals, 10));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThan, 10));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThan, 11));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThanEquals, 9));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThanEquals, 10));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThan, 34));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThan, 33));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThanEquals, 35));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThanEquals, 34));
+
+  const auto constant_statistics = SegmentStatistics<int32_t>{7, 7, 100, 1};
+  EXPECT_TRUE(constant_statistics.can_prune(ScanType::OpNotEquals, 7));
+  EXPECT_FALSE(constant_statistics.can_prune(ScanType::OpNotEquals, 8));
+
+  // values of other types are never pruned
+  const auto& base_statistics = static_cast<const BaseSegmentStatistics&>(statistics);
+  EXPECT_TRUE(base_statistics.can_prune(ScanType::OpEquals, AllTypeVariant{35}));
+  EXPECT_FALSE(base_statistics.can_prune(ScanType::OpEquals, AllTypeVariant{35.0}));
+  EXPECT_FALSE(base_statistics.can_prune(ScanType::OpEquals, AllTypeVariant{"35"}));
+
+  const auto empty_statistics = SegmentStatistics<int32_t>{ValueSegment<int32_t>{}};
+  EXPECT_TRUE(empty_statistics.can_prune(ScanType::OpNotEquals, 1));
+}
+
+TEST_F(StorageSegmentStatisticsTest, BloomFilter) {
+  // unsorted values with gaps, so that the value range does not help
+  auto segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto i = 0; i < 1'000; ++i) segment->append((i * 7'919) % 1'000 * 10);
+
+  for (const auto encoding_type : {EncodingType::Unencoded, EncodingType::Dictionary}) {
+    const auto encoded_segment = ChunkEncoder::encode_segment(segment, "int", encoding_type);
+    const auto statistics = SegmentStatistics<int32_t>{*encoded_segment};
+    EXPECT_TRUE(statistics.has_bloom_filter());
+
+    auto skipped_lookups = 0;
+    for (auto value = 0; value < 10'000; ++value) {
+      if (value % 10 == 0) {
+        EXPECT_TRUE(statistics.may_contain(value));
+        EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, value));
+      } else if (!statistics.may_contain(value)) {
+        EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, value));
+        ++skipped_lookups;
+      }
+    }
+    EXPECT_GT(skipped_lookups, 8'500);
+  }
+
+  const auto statistics_without_filter = SegmentStatistics<int32_t>{*segment, false};
+  EXPECT_FALSE(statistics_without_filter.has_bloom_filter());
+  // the filter of 1'000 distinct values takes 10 bits per value
+  EXPECT_GE(SegmentStatistics<int32_t>{*segment}.estimate_memory_usage(),
+            statistics_without_filter.estimate_memory_usage() + 1'000 * BloomFilter::BITS_PER_VALUE / 8);
+  EXPECT_TRUE(statistics_without_filter.may_contain(15));
+  EXPECT_FALSE(statistics_without_filter.may_contain(10'000));
+}
+
+TEST_F(StorageSegmentStatisticsTest, ChunkPruning) {
+  const auto chunk = std::make_shared<Chunk>();
+  chunk->add_segment(int_segment);
+  chunk->add_segment(string_segment);
+
+  EXPECT_EQ(chunk->get_segment_statistics(ColumnID{0}), nullptr);
+  EXPECT_FALSE(chunk->can_prune(ColumnID{0}, ScanType::OpGreaterThan, 100));
+
+  ChunkEncoder::encode_chunk(chunk, {"int", "string"});
+  ASSERT_NE(chunk->get_segment_statistics(ColumnID{0}), nullptr);
+  const auto bytes_with_statistics = chunk->estimate_memory_usage();
+  const auto string_statistics = chunk->get_segment_statistics(ColumnID{1});
+  chunk->set_segment_statistics(ColumnID{1}, nullptr);
+  EXPECT_EQ(chunk->estimate_memory_usage() + string_statistics->estimate_memory_usage(), bytes_with_statistics);
+  chunk->set_segment_statistics(ColumnID{1}, string_statistics);
+  EXPECT_TRUE(chunk->can_prune(ColumnID{0}, ScanType::OpGreaterThan, 100));
+  EXPECT_FALSE(chunk->can_prune(ColumnID{0}, ScanType::OpGreaterThan, 20));
+  EXPECT_TRUE(chunk->can_prune(ColumnID{1}, ScanType::OpEquals, "w"));
+  EXPECT_FALSE(chunk->can_prune(ColumnID{1}, ScanType::OpEquals, "v3"));
+  EXPECT_TRUE(chunk->may_contain(ColumnID{1}, "v3"));
+  EXPECT_FALSE(chunk->may_contain(ColumnID{1}, "v30"));
+  EXPECT_TRUE(chunk->may_contain(ColumnID{1}, 3));
+}
+
+TEST_F(StorageSegmentStatisticsTest, TableFinalizesChunks) {
+  // statistics are computed for full chunks even without background encoding
+  auto table = Table{10};
+  table.add_column("a", "int");
+  table.set_background_encoding(false);
+  for (auto i = 0; i < 15; ++i) table.append({i});
+  table.wait_for_background_encoding();
+
+  EXPECT_NE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0})),
+            nullptr);
+  EXPECT_TRUE(table.get_chunk(ChunkID{0}).can_prune(ColumnID{0}, ScanType::OpGreaterThan, 9));
+  EXPECT_EQ(table.get_chunk(ChunkID{1}).get_segment_statistics(ColumnID{0}), nullptr);
+
+  // emplaced chunks are final, so later rows go to a new chunk
+  auto chunk = Chunk{};
+  chunk.add_segment(int_segment);
+  table.emplace_chunk(std::move(chunk));
+  table.append({1'000});
+  table.wait_for_background_encoding();
+
+  EXPECT_EQ(table.chunk_count(), 4u);
+  EXPECT_TRUE(table.get_chunk(ChunkID{2}).can_prune(ColumnID{0}, ScanType::OpGreaterThan, 40));
+  EXPECT_EQ(table.get_chunk(ChunkID{3}).size(), 1u);
+}
+
+}  // namespace opossum
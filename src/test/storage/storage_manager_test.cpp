@@ -1,4 +1,6 @@
 #include <memory>
+#include <sstream>
+#include <string>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -8,46 +10,66 @@
 
 namespace opossum {
 
-// class StorageStorageManagerTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     auto& sm = StorageManager::get();
-//     auto t1 = std::make_shared<Table>();
-//     auto t2 = std::make_shared<Table>(4);
-
-//     sm.add_table("first_table", t1);
-//     sm.add_table("second_table", t2);
-//   }
-// };
-
-// TEST_F(StorageStorageManagerTest, GetTable) {
-//   auto& sm = StorageManager::get();
-//   auto t3 = sm.get_table("first_table");
-//   auto t4 = sm.get_table("second_table");
-//   EXPECT_THROW(sm.get_table("third_table"), std::exception);
-// }
-
-// TEST_F(StorageStorageManagerTest, DropTable) {
-//   auto& sm = StorageManager::get();
-//   sm.drop_table("first_table");
-//   EXPECT_THROW(sm.get_table("first_table"), std::exception);
-//   EXPECT_THROW(sm.drop_table("first_table"), std::exception);
-// }
-
-// TEST_F(StorageStorageManagerTest, ResetTable) {
-//   StorageManager::get().reset();
-//   auto& sm = StorageManager::get();
-//   EXPECT_THROW(sm.get_table("first_table"), std::exception);
-// }
-
-// TEST_F(StorageStorageManagerTest, DoesNotHaveTable) {
-//   auto& sm = StorageManager::get();
-//   EXPECT_EQ(sm.has_table("third_table"), false);
-// }
-
-// TEST_F(StorageStorageManagerTest, HasTable) {
-//   auto& sm = StorageManager::get();
-//   EXPECT_EQ(sm.has_table("first_table"), true);
-// }
+class StorageStorageManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto& sm = StorageManager::get();
+    auto t1 = std::make_shared<Table>();
+    auto t2 = std::make_shared<Table>(4);
+
+    sm.add_table("first_table", t1);
+    sm.add_table("second_table", t2);
+  }
+};
+
+TEST_F(StorageStorageManagerTest, GetTable) {
+  auto& sm = StorageManager::get();
+  auto t3 = sm.get_table("first_table");
+  auto t4 = sm.get_table("second_table");
+  EXPECT_THROW(sm.get_table("third_table"), std::exception);
+}
+
+TEST_F(StorageStorageManagerTest, DropTable) {
+  auto& sm = StorageManager::get();
+  sm.drop_table("first_table");
+  EXPECT_THROW(sm.get_table("first_table"), std::exception);
+  EXPECT_THROW(sm.drop_table("first_table"), std::exception);
+}
+
+TEST_F(StorageStorageManagerTest, ResetTable) {
+  StorageManager::get().reset();
+  auto& sm = StorageManager::get();
+  EXPECT_THROW(sm.get_table("first_table"), std::exception);
+}
+
+TEST_F(StorageStorageManagerTest, DoesNotHaveTable) {
+  auto& sm = StorageManager::get();
+  EXPECT_EQ(sm.has_table("third_table"), false);
+}
+
+TEST_F(StorageStorageManagerTest, Print) {
+  auto& sm = StorageManager::get();
+  auto t3 = std::make_shared<Table>(2);
+  t3->add_column("a", "int");
+  t3->set_background_encoding(false);
+  for (auto i = 0; i < 5; ++i) t3->append({i});
+  t3->compress_chunk(ChunkID{0});
+  sm.add_table("third_table", t3);
+
+  std::ostringstream output;
+  sm.print(output);
+  const auto printed = output.str();
+  EXPECT_NE(printed.find("third_table (1 columns, 5 rows, 3 chunks, " + std::to_string(t3->estimate_memory_usage()) +
+                         " bytes)"),
+            std::string::npos);
+  EXPECT_NE(printed.find("a (int): "), std::string::npos);
+  EXPECT_NE(printed.find("Dictionary: 1 chunks"), std::string::npos);
+  EXPECT_NE(printed.find("Unencoded: 2 chunks"), std::string::npos);
+}
+
+TEST_F(StorageStorageManagerTest, HasTable) {
+  auto& sm = StorageManager::get();
+  EXPECT_EQ(sm.has_table("first_table"), true);
+}
 
 }  // namespace opossum
@@ -8,67 +8,140 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/utils/memory_resources.hpp"
 
 namespace opossum {
 
-// class StorageTableTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     t.add_column("col_1", "int");
-//     t.add_column("col_2", "string");
-//   }
-
-//   Table t{2};
-// };
-
-// TEST_F(StorageTableTest, ChunkCount) {
-//   EXPECT_EQ(t.chunk_count(), 1u);
-//   t.append({4, "Hello,"});
-//   t.append({6, "world"});
-//   t.append({3, "!"});
-//   EXPECT_EQ(t.chunk_count(), 2u);
-// }
-
-// TEST_F(StorageTableTest, GetChunk) {
-//   t.get_chunk(ChunkID{0});
-//   // TODO(anyone): Do we want checks here?
-//   // EXPECT_THROW(t.get_chunk(ChunkID{q}), std::exception);
-//   t.append({4, "Hello,"});
-//   t.append({6, "world"});
-//   t.append({3, "!"});
-//   t.get_chunk(ChunkID{1});
-// }
-
-// TEST_F(StorageTableTest, ColumnCount) { EXPECT_EQ(t.column_count(), 2u); }
-
-// TEST_F(StorageTableTest, RowCount) {
-//   EXPECT_EQ(t.row_count(), 0u);
-//   t.append({4, "Hello,"});
-//   t.append({6, "world"});
-//   t.append({3, "!"});
-//   EXPECT_EQ(t.row_count(), 3u);
-// }
-
-// TEST_F(StorageTableTest, GetColumnName) {
-//   EXPECT_EQ(t.column_name(ColumnID{0}), "col_1");
-//   EXPECT_EQ(t.column_name(ColumnID{1}), "col_2");
-//   // TODO(anyone): Do we want checks here?
-//   // EXPECT_THROW(t.column_name(ColumnID{2}), std::exception);
-// }
-
-// TEST_F(StorageTableTest, GetColumnType) {
-//   EXPECT_EQ(t.column_type(ColumnID{0}), "int");
-//   EXPECT_EQ(t.column_type(ColumnID{1}), "string");
-//   // TODO(anyone): Do we want checks here?
-//   // EXPECT_THROW(t.column_type(ColumnID{2}), std::exception);
-// }
-
-// TEST_F(StorageTableTest, GetColumnIdByName) {
-//   EXPECT_EQ(t.column_id_by_name("col_2"), 1u);
-//   EXPECT_THROW(t.column_id_by_name("no_column_name"), std::exception);
-// }
-
-// TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.max_chunk_size(), 2u); }
+class StorageTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    t.add_column("col_1", "int");
+    t.add_column("col_2", "string");
+  }
+
+  Table t{2};
+};
+
+TEST_F(StorageTableTest, ChunkCount) {
+  EXPECT_EQ(t.chunk_count(), 1u);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_EQ(t.chunk_count(), 2u);
+}
+
+TEST_F(StorageTableTest, GetChunk) {
+  t.get_chunk(ChunkID{0});
+  // TODO(anyone): Do we want checks here?
+  // EXPECT_THROW(t.get_chunk(ChunkID{q}), std::exception);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.get_chunk(ChunkID{1});
+}
+
+TEST_F(StorageTableTest, ColumnCount) { EXPECT_EQ(t.column_count(), 2u); }
+
+TEST_F(StorageTableTest, RowCount) {
+  EXPECT_EQ(t.row_count(), 0u);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_EQ(t.row_count(), 3u);
+}
+
+TEST_F(StorageTableTest, GetColumnName) {
+  EXPECT_EQ(t.column_name(ColumnID{0}), "col_1");
+  EXPECT_EQ(t.column_name(ColumnID{1}), "col_2");
+  // TODO(anyone): Do we want checks here?
+  // EXPECT_THROW(t.column_name(ColumnID{2}), std::exception);
+}
+
+TEST_F(StorageTableTest, GetColumnType) {
+  EXPECT_EQ(t.column_type(ColumnID{0}), "int");
+  EXPECT_EQ(t.column_type(ColumnID{1}), "string");
+  // TODO(anyone): Do we want checks here?
+  // EXPECT_THROW(t.column_type(ColumnID{2}), std::exception);
+}
+
+TEST_F(StorageTableTest, GetColumnIdByName) {
+  EXPECT_EQ(t.column_id_by_name("col_2"), 1u);
+  EXPECT_THROW(t.column_id_by_name("no_column_name"), std::exception);
+}
+
+TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.max_chunk_size(), 2u); }
+
+TEST_F(StorageTableTest, AppendColumns) {
+  t.append({4, "Hello,"});
+  t.append_columns({pmr_vector<int32_t>{6, 3, 7}, pmr_vector<std::string>{"world", "!", "again"}});
+
+  EXPECT_EQ(t.row_count(), 4u);
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ((*t.get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+  EXPECT_EQ((*t.get_chunk(ChunkID{1}).get_segment(ColumnID{0}))[1], AllTypeVariant{7});
+
+  EXPECT_THROW(t.append_columns({pmr_vector<int32_t>{1}}), std::exception);
+  EXPECT_THROW(t.append_columns({pmr_vector<int32_t>{1}, pmr_vector<std::string>{}}), std::exception);
+  EXPECT_THROW(t.append_columns({pmr_vector<std::string>{"1"}, pmr_vector<std::string>{"1"}}), std::exception);
+}
+
+TEST_F(StorageTableTest, AppendColumnsWithoutCopy) {
+  Table table;
+  table.add_column("col_1", "long");
+
+  auto values = pmr_vector<int64_t>(1'000, 17);
+  const auto* const data = values.data();
+  // a braced initializer list would copy the vectors
+  std::vector<ColumnValues> columns;
+  columns.emplace_back(std::move(values));
+  table.append_columns(std::move(columns));
+
+  const auto segment = table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<int64_t>>(segment);
+  ASSERT_NE(value_segment, nullptr);
+  EXPECT_EQ(value_segment->values().data(), data);
+  EXPECT_EQ(table.row_count(), 1'000u);
+}
+
+TEST_F(StorageTableTest, MemoryResource) {
+  EXPECT_EQ(t.memory_resource(), std::pmr::get_default_resource());
+
+  const auto memory_resource = std::make_shared<MonotonicArena>();
+  t.set_memory_resource(memory_resource);
+  EXPECT_EQ(t.memory_resource(), memory_resource.get());
+
+  // encoding would replace the ValueSegments of the full chunk
+  t.set_background_encoding(false);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  for (auto chunk_id = ChunkID{0}; chunk_id < t.chunk_count(); ++chunk_id) {
+    const auto& chunk = t.get_chunk(chunk_id);
+    const auto int_segment = std::dynamic_pointer_cast<ValueSegment<int32_t>>(chunk.get_segment(ColumnID{0}));
+    const auto string_segment = std::dynamic_pointer_cast<ValueSegment<std::string>>(chunk.get_segment(ColumnID{1}));
+    ASSERT_NE(int_segment, nullptr);
+    ASSERT_NE(string_segment, nullptr);
+    EXPECT_EQ(int_segment->values().get_allocator().resource(), memory_resource.get());
+    EXPECT_EQ(string_segment->chars().get_allocator().resource(), memory_resource.get());
+  }
+
+  EXPECT_THROW(t.set_memory_resource(std::make_shared<AlignedMemoryResource>()), std::exception);
+}
+
+TEST_F(StorageTableTest, CompressChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.compress_chunk(ChunkID{0});
+
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  EXPECT_EQ(chunk.size(), 2u);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk.get_segment(ColumnID{0})), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk.get_segment(ColumnID{1})), nullptr);
+  EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+  EXPECT_EQ(t.row_count(), 3u);
+}
 
 }  // namespace opossum
@@ -9,42 +9,58 @@
 
 namespace opossum {
 
-// class StorageValueSegmentTest : public BaseTest {
-//  protected:
-//   ValueSegment<int> int_value_segment;
-//   ValueSegment<std::string> string_value_segment;
-//   ValueSegment<double> double_value_segment;
-// };
-
-// TEST_F(StorageValueSegmentTest, GetSize) {
-//   EXPECT_EQ(int_value_segment.size(), 0u);
-//   EXPECT_EQ(string_value_segment.size(), 0u);
-//   EXPECT_EQ(double_value_segment.size(), 0u);
-// }
-
-// TEST_F(StorageValueSegmentTest, AddValueOfSameType) {
-//   int_value_segment.append(3);
-//   EXPECT_EQ(int_value_segment.size(), 1u);
-
-//   string_value_segment.append("Hello");
-//   EXPECT_EQ(string_value_segment.size(), 1u);
-
-//   double_value_segment.append(3.14);
-//   EXPECT_EQ(double_value_segment.size(), 1u);
-// }
-
-// TEST_F(StorageValueSegmentTest, AddValueOfDifferentType) {
-//   int_value_segment.append(3.14);
-//   EXPECT_EQ(int_value_segment.size(), 1u);
-//   EXPECT_THROW(int_value_segment.append("Hi"), std::exception);
-
-//   string_value_segment.append(3);
-//   string_value_segment.append(4.44);
-//   EXPECT_EQ(string_value_segment.size(), 2u);
-
-//   double_value_segment.append(4);
-//   EXPECT_EQ(double_value_segment.size(), 1u);
-//   EXPECT_THROW(double_value_segment.append("Hi"), std::exception);
-// }
+class StorageValueSegmentTest : public BaseTest {
+ protected:
+  ValueSegment<int> int_value_segment;
+  ValueSegment<std::string> string_value_segment;
+  ValueSegment<double> double_value_segment;
+};
+
+TEST_F(StorageValueSegmentTest, GetSize) {
+  EXPECT_EQ(int_value_segment.size(), 0u);
+  EXPECT_EQ(string_value_segment.size(), 0u);
+  EXPECT_EQ(double_value_segment.size(), 0u);
+}
+
+TEST_F(StorageValueSegmentTest, AddValueOfSameType) {
+  int_value_segment.append(3);
+  EXPECT_EQ(int_value_segment.size(), 1u);
+
+  string_value_segment.append("Hello");
+  EXPECT_EQ(string_value_segment.size(), 1u);
+
+  double_value_segment.append(3.14);
+  EXPECT_EQ(double_value_segment.size(), 1u);
+}
+
+TEST_F(StorageValueSegmentTest, AddValueOfDifferentType) {
+  int_value_segment.append(3.14);
+  EXPECT_EQ(int_value_segment.size(), 1u);
+  EXPECT_THROW(int_value_segment.append("Hi"), std::exception);
+
+  string_value_segment.append(3);
+  string_value_segment.append(4.44);
+  EXPECT_EQ(string_value_segment.size(), 2u);
+
+  double_value_segment.append(4);
+  EXPECT_EQ(double_value_segment.size(), 1u);
+  EXPECT_THROW(double_value_segment.append("Hi"), std::exception);
+}
+
+TEST_F(StorageValueSegmentTest, ContiguousStrings) {
+  string_value_segment.append("Hello");
+  string_value_segment.append("");
+  string_value_segment.append("a string that is too long for the small string optimization");
+  string_value_segment.append(42);
+
+  EXPECT_EQ(string_value_segment.size(), 4u);
+  EXPECT_EQ(string_value_segment.get(0), "Hello");
+  EXPECT_EQ(string_value_segment.get(1), "");
+  EXPECT_EQ(string_value_segment.get(2), "a string that is too long for the small string optimization");
+  EXPECT_EQ(string_value_segment[3], AllTypeVariant{"42"});
+
+  EXPECT_EQ(string_value_segment.chars().size(), 66u);
+  EXPECT_EQ(string_value_segment.offsets(), (pmr_vector<size_t>{0, 5, 5, 64, 66}));
+}
 
 }  // namespace opossum
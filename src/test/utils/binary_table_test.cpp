@@ -0,0 +1,130 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/chunk_encoder.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/segment_statistics.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/utils/binary_table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class UtilsBinaryTableTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  const std::string _file_name = "binary_table_test.bin";
+};
+
+TEST_F(UtilsBinaryTableTest, RoundTripUnencoded) {
+  const auto table = load_table("src/test/tables/all_data_types.tbl", 2);
+  export_binary(*table, _file_name);
+
+  const auto imported_table = import_binary(_file_name);
+  EXPECT_EQ(imported_table->max_chunk_size(), 2u);
+  EXPECT_EQ(imported_table->chunk_count(), table->chunk_count());
+  EXPECT_EQ(imported_table->column_names(), table->column_names());
+  EXPECT_TABLE_EQ(imported_table, table, true);
+}
+
+TEST_F(UtilsBinaryTableTest, RoundTripKeepsEncoding) {
+  const auto table = load_table("src/test/tables/all_data_types.tbl", 2);
+  // the segments are replaced below, which must not race with the background encoding
+  table->wait_for_background_encoding();
+
+  // use a bit-packed attribute vector for one of the dictionary segments, the other segments use the defaults
+  auto& first_chunk = table->get_chunk(ChunkID{0});
+  const auto unencoded_segment =
+      ChunkEncoder::encode_segment(first_chunk.get_segment(ColumnID{4}), "string", EncodingType::Unencoded);
+  first_chunk.replace_segment(ColumnID{4}, std::make_shared<DictionarySegment<std::string>>(
+                                               unencoded_segment, AttributeVectorEncoding::BitPacked));
+
+  const auto encoding_types = {EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FrameOfReference};
+
+  auto chunk_id = ChunkID{0};
+  for (const auto encoding_type : encoding_types) {
+    auto& chunk = table->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto& data_type = table->column_type(column_id);
+      if (chunk_id == ChunkID{0} && column_id == ColumnID{4}) continue;
+
+      const auto is_integral = data_type == "int" || data_type == "long";
+      const auto segment_encoding_type =
+          encoding_type == EncodingType::FrameOfReference && !is_integral ? EncodingType::Unencoded : encoding_type;
+      const auto segment = chunk.get_segment(column_id);
+      chunk.replace_segment(column_id, ChunkEncoder::encode_segment(segment, data_type, segment_encoding_type));
+    }
+    ++chunk_id;
+  }
+
+  export_binary(*table, _file_name);
+  const auto imported_table = import_binary(_file_name);
+  EXPECT_TABLE_EQ(imported_table, table, true);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto& data_type = table->column_type(column_id);
+      EXPECT_EQ(ChunkEncoder::get_encoding_type(imported_table->get_chunk(chunk_id).get_segment(column_id), data_type),
+                ChunkEncoder::get_encoding_type(table->get_chunk(chunk_id).get_segment(column_id), data_type));
+    }
+  }
+
+  const auto string_segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      imported_table->get_chunk(ChunkID{0}).get_segment(ColumnID{4}));
+  ASSERT_NE(string_segment, nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<const BitPackedAttributeVector>(string_segment->attribute_vector()), nullptr);
+}
+
+TEST_F(UtilsBinaryTableTest, RoundTripKeepsStatistics) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  table->wait_for_background_encoding();
+  export_binary(*table, _file_name);
+
+  // the statistics of the full first chunk are read from the file rather than computed in the background
+  const auto imported_table = import_binary(_file_name);
+  const auto expected_statistics = std::dynamic_pointer_cast<const SegmentStatistics<int32_t>>(
+      table->get_chunk(ChunkID{0}).get_segment_statistics(ColumnID{0}));
+  const auto statistics = std::dynamic_pointer_cast<const SegmentStatistics<int32_t>>(
+      imported_table->get_chunk(ChunkID{0}).get_segment_statistics(ColumnID{0}));
+  ASSERT_NE(expected_statistics, nullptr);
+  ASSERT_NE(statistics, nullptr);
+  EXPECT_EQ(statistics->min(), expected_statistics->min());
+  EXPECT_EQ(statistics->max(), expected_statistics->max());
+  EXPECT_EQ(statistics->row_count(), expected_statistics->row_count());
+  EXPECT_EQ(statistics->distinct_count(), expected_statistics->distinct_count());
+  ASSERT_TRUE(statistics->has_bloom_filter());
+  EXPECT_EQ(statistics->bloom_filter()->words(), expected_statistics->bloom_filter()->words());
+  EXPECT_TRUE(statistics->may_contain(expected_statistics->min()));
+  EXPECT_NE(imported_table->get_chunk(ChunkID{0}).get_segment_statistics(ColumnID{1}), nullptr);
+
+  // the last chunk was not full when it was exported, so its statistics are computed after the import
+  EXPECT_EQ(table->get_chunk(ChunkID{1}).get_segment_statistics(ColumnID{0}), nullptr);
+  imported_table->wait_for_background_encoding();
+  EXPECT_NE(imported_table->get_chunk(ChunkID{1}).get_segment_statistics(ColumnID{0}), nullptr);
+}
+
+TEST_F(UtilsBinaryTableTest, InvalidFiles) {
+  EXPECT_THROW(import_binary("src/test/tables/does_not_exist.bin"), std::exception);
+  EXPECT_THROW(import_binary("src/test/tables/all_data_types.tbl"), std::exception);
+
+  // a truncated snapshot must not be read beyond its end
+  const auto table = load_table("src/test/tables/all_data_types.tbl", 2);
+  export_binary(*table, _file_name);
+  auto content = std::string{};
+  {
+    auto input = std::ifstream{_file_name, std::ios::binary};
+    content.assign(std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{});
+  }
+  std::ofstream{_file_name, std::ios::binary | std::ios::trunc}.write(content.data(), content.size() - 5);
+  EXPECT_THROW(import_binary(_file_name), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/load_table.hpp"
+#include "../lib/utils/memory_resources.hpp"
+
+namespace opossum {
+
+class UtilsLoadTableTest : public BaseTest {};
+
+TEST_F(UtilsLoadTableTest, LoadTable) {
+  const auto table = load_table("src/test/tables/all_data_types.tbl", 2);
+  EXPECT_EQ(table->column_count(), 5u);
+  EXPECT_EQ(table->row_count(), 5u);
+  EXPECT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->column_type(ColumnID{4}), "string");
+}
+
+TEST_F(UtilsLoadTableTest, LoadTableParallelMatchesLoadTable) {
+  for (const auto& file_name : {"src/test/tables/all_data_types.tbl", "src/test/tables/int_float.tbl"}) {
+    const auto expected_table = load_table(file_name, 2);
+    for (const auto worker_count : {size_t{0}, size_t{1}, size_t{3}}) {
+      const auto table = load_table_parallel(file_name, 2, worker_count);
+      EXPECT_EQ(table->chunk_count(), expected_table->chunk_count());
+      EXPECT_TABLE_EQ(table, expected_table, true);
+    }
+  }
+
+  const auto table = load_table_parallel("src/test/tables/all_data_types.tbl", 2);
+  const auto segment = table->get_chunk(ChunkID{1}).get_segment(ColumnID{4});
+  const auto string_segment = std::dynamic_pointer_cast<ValueSegment<std::string>>(segment);
+  ASSERT_NE(string_segment, nullptr);
+  EXPECT_EQ(string_segment->get(1), "a very long string that does not fit into the small string optimization");
+}
+
+TEST_F(UtilsLoadTableTest, LoadTableParallelWithMemoryResource) {
+  const auto memory_resource = std::make_shared<MonotonicArena>();
+  const auto table = load_table_parallel("src/test/tables/all_data_types.tbl", 2, 3, memory_resource);
+  EXPECT_EQ(table->memory_resource(), memory_resource.get());
+  EXPECT_TABLE_EQ(table, load_table("src/test/tables/all_data_types.tbl", 2), true);
+
+  const auto segment = table->get_chunk(ChunkID{2}).get_segment(ColumnID{0});
+  const auto int_segment = std::dynamic_pointer_cast<ValueSegment<int32_t>>(segment);
+  ASSERT_NE(int_segment, nullptr);
+  EXPECT_EQ(int_segment->values().get_allocator().resource(), memory_resource.get());
+}
+
+TEST_F(UtilsLoadTableTest, LoadTableParallelErrors) {
+  EXPECT_THROW(load_table_parallel("src/test/tables/does_not_exist.tbl", 2), std::exception);
+  EXPECT_THROW(load_table_parallel("src/test/tables/malformed.tbl", 2), std::exception);
+  // as in load_table, an empty line is a row without fields rather than being skipped
+  EXPECT_THROW(load_table_parallel("src/test/tables/empty_line.tbl", 2), std::exception);
+}
+
+}  // namespace opossum
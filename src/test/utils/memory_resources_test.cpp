@@ -0,0 +1,56 @@
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/utils/memory_resources.hpp"
+
+namespace opossum {
+
+class UtilsMemoryResourcesTest : public BaseTest {};
+
+TEST_F(UtilsMemoryResourcesTest, AlignedMemoryResource) {
+  auto memory_resource = AlignedMemoryResource{};
+  auto values = pmr_vector<int32_t>(&memory_resource);
+  for (auto size = 1; size < 10'000; size *= 3) {
+    values.resize(size);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(values.data()) % AlignedMemoryResource::CACHE_LINE_SIZE, 0u);
+  }
+
+  EXPECT_TRUE(memory_resource.is_equal(AlignedMemoryResource{true}));
+  EXPECT_FALSE(memory_resource.is_equal(*std::pmr::new_delete_resource()));
+}
+
+TEST_F(UtilsMemoryResourcesTest, AlignedMemoryResourceHugePages) {
+  auto memory_resource = AlignedMemoryResource{true};
+  EXPECT_TRUE(memory_resource.uses_huge_pages());
+
+  auto* const pointer = memory_resource.allocate(AlignedMemoryResource::HUGE_PAGE_SIZE);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(pointer) % AlignedMemoryResource::HUGE_PAGE_SIZE, 0u);
+  memory_resource.deallocate(pointer, AlignedMemoryResource::HUGE_PAGE_SIZE);
+}
+
+TEST_F(UtilsMemoryResourcesTest, MonotonicArena) {
+  auto memory_resource = MonotonicArena{1024};
+  EXPECT_TRUE(memory_resource.is_equal(memory_resource));
+  EXPECT_FALSE(memory_resource.is_equal(MonotonicArena{}));
+
+  // concurrent allocations must not overlap
+  auto threads = std::vector<std::thread>{};
+  auto vectors = std::vector<pmr_vector<size_t>>(4, pmr_vector<size_t>(&memory_resource));
+  for (auto thread_id = size_t{0}; thread_id < vectors.size(); ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto index = size_t{0}; index < 10'000; ++index) vectors[thread_id].push_back(thread_id);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  for (auto thread_id = size_t{0}; thread_id < vectors.size(); ++thread_id) {
+    EXPECT_EQ(vectors[thread_id], pmr_vector<size_t>(10'000, thread_id));
+  }
+}
+
+}  // namespace opossum